@@ -4,6 +4,29 @@
 #include <iomanip>
 #include <queue>
 #include <climits>
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <fstream>
+#include <cstdio>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <set>
+#include <tuple>
+#include <memory>
+#include <cstring>
+#include <unordered_map>
+#include <cctype>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SCHED_HAVE_X86 1
+#endif
 
 using namespace std;
 
@@ -11,10 +34,76 @@ struct Process {
     string name; int arrivalTime; int burstTime; int completionTime; 
     int waitingTime; int turnAroundTime; double normTurn; int remainingTime; // Used for Shortest Process Next algorithm
     int priority; // Used for Highest Priority algorithm
-    bool isCompleted;
     int processno;
     int burstTimeBackup;
+    int jobClass; // Groups processes whose bursts predict each other (burst prediction)
+    int deadline; // Absolute deadline, 0 = none (EDF)
+    vector<int> bursts; // Alternating CPU / I/O phases (CPU, I/O, CPU, ...); empty = one CPU burst of burstTime
+    bool isCompleted;
+    int preemptions; // Times the process was preempted (preemptive policies; 0 for non-preemptive ones)
+    int firstStartTime; // First time the process got the CPU (-1 until dispatched)
+    int responseTime; // RT = first start - AT
+    double predictedBurst; // Burst estimate used by the prediction-based SPN/SRTF
+    int ioTime; // Time spent blocked on I/O
+};
+
+// Function to record a dispatch; only the first one sets the start and response time
+inline void markDispatch(Process& process, int currentTime) {
+    if (process.firstStartTime < 0) {
+        process.firstStartTime = currentTime;
+        process.responseTime = currentTime - process.arrivalTime;
+    }
+}
+
+// Receiver of execution slices; schedulers report to the current thread's sink, if any
+struct SliceSink {
+    virtual void slice(const Process& process, int start, int end) = 0;
+    virtual ~SliceSink() = default;
 };
+thread_local SliceSink* sliceSink = nullptr;
+
+// Function to record that the process ran on the CPU during [start, end)
+inline void recordSlice(const Process& process, int start, int end) {
+    if (sliceSink && end > start) sliceSink->slice(process, start, end);
+}
+
+// Function to check whether any process has CPU / I-O phases
+bool hasPhases(const vector<Process>& processes) {
+    for (const auto& process : processes) {
+        if (!process.bursts.empty()) return true;
+    }
+    return false;
+}
+
+// Function to return the total CPU time of a process (the sum of its CPU phases, or BT without phases)
+int cpuTime(const Process& process) {
+    if (process.bursts.empty()) return process.burstTime;
+    int total = 0;
+    for (size_t phase = 0; phase < process.bursts.size(); phase += 2) {
+        total += process.bursts[phase];
+    }
+    return total;
+}
+
+// Function to fold CPU / I-O phases into one CPU burst (total CPU time) for runs that model no I/O; returns the processes folded
+int foldPhases(vector<Process>& processes) {
+    int folded = 0;
+    for (auto& process : processes) {
+        if (process.bursts.empty()) continue;
+        process.burstTime = cpuTime(process);
+        process.bursts.clear();
+        folded++;
+    }
+    return folded;
+}
+
+// Function to set CT, TAT, WT and NT of a process that finished at `time` (WT excludes time blocked on I/O)
+void finishProcess(Process& process, int time) {
+    process.completionTime = time;
+    process.turnAroundTime = process.completionTime - process.arrivalTime;
+    process.waitingTime = process.turnAroundTime - process.burstTime - process.ioTime;
+    process.normTurn = (double)process.turnAroundTime / process.burstTime;
+}
 
 // Function to compare processes by arrival time
 bool compareArrival(const Process& a, const Process& b) {
@@ -23,13 +112,259 @@ bool compareArrival(const Process& a, const Process& b) {
 
 ///////////////////////////////////////////////////////////////////////////////////////////
 
+/*
+Function to run body(worker, item) for every item in [0, count) on `threads` workers.
+Workers claim small chunks from a shared atomic cursor, so a worker that finishes early
+keeps pulling work instead of idling behind a static partition. Worker ids are stable,
+which lets callers keep per-worker buffers.
+*/
+void parallelFor(int count, int threads, const function<void(int, int)>& body) {
+    threads = max(1, min(threads, count));
+    const int chunk = max(1, min(64, count / (threads * 8)));
+    atomic<int> cursor(0);
+    auto work = [&](int worker) {
+        for (;;) {
+            int begin = cursor.fetch_add(chunk);
+            if (begin >= count) return;
+            int end = min(count, begin + chunk);
+            for (int item = begin; item < end; ++item) {
+                body(worker, item);
+            }
+        }
+    };
+    vector<thread> pool;
+    for (int w = 1; w < threads; ++w) {
+        pool.emplace_back(work, w);
+    }
+    work(0);
+    for (auto& t : pool) {
+        t.join();
+    }
+}
+
+// Arrival ordering
+/*
+LSD radix sort of (arrivalTime, original index) keys, 8 bits per pass. It sorts 4-byte
+keys and int indices instead of whole Process structs, is stable (ties keep input
+order) and skips passes where every key has the same digit. Large inputs are split into
+chunks that are histogrammed and scattered in parallel; per-chunk offsets keep the
+scatter stable. Small inputs (a few dozen jobs, as in batch mode) use an insertion sort
+instead, which avoids the histogram passes and scratch buffers.
+*/
+const int RADIX_PARALLEL_THRESHOLD = 1 << 16;
+const int RADIX_MIN_SIZE = 64;
+
+// Function to return the permutation that orders processes by arrival time
+vector<int> arrivalOrder(const vector<Process>& processes) {
+    int n = processes.size();
+    if (n < RADIX_MIN_SIZE) {
+        vector<int> order(n);
+        for (int i = 0; i < n; ++i) {
+            int j = i;
+            while (j > 0 && processes[order[j - 1]].arrivalTime > processes[i].arrivalTime) {
+                order[j] = order[j - 1];
+                j--;
+            }
+            order[j] = i;
+        }
+        return order;
+    }
+    vector<uint32_t> keys(n), keysTmp(n);
+    vector<int> order(n), orderTmp(n);
+    for (int i = 0; i < n; ++i) {
+        keys[i] = (uint32_t)processes[i].arrivalTime ^ 0x80000000u; // negative times sort first
+        order[i] = i;
+    }
+
+    int chunks = 1;
+    if (n >= RADIX_PARALLEL_THRESHOLD) {
+        chunks = max(1, min(8, (int)thread::hardware_concurrency()));
+    }
+    int chunkSize = (n + chunks - 1) / max(1, chunks);
+    vector<vector<int>> counts(chunks, vector<int>(256));
+
+    for (int shift = 0; shift < 32; shift += 8) {
+        parallelFor(chunks, chunks, [&](int, int c) {
+            vector<int>& count = counts[c];
+            fill(count.begin(), count.end(), 0);
+            int end = min(n, (c + 1) * chunkSize);
+            for (int i = c * chunkSize; i < end; ++i) {
+                count[(keys[i] >> shift) & 255]++;
+            }
+        });
+
+        // Exclusive offsets, digit-major then chunk-major so earlier chunks stay first
+        bool trivial = false;
+        int running = 0;
+        for (int digit = 0; digit < 256; ++digit) {
+            int digitTotal = 0;
+            for (int c = 0; c < chunks; ++c) {
+                int count = counts[c][digit];
+                counts[c][digit] = running;
+                running += count;
+                digitTotal += count;
+            }
+            trivial = trivial || digitTotal == n;
+        }
+        if (trivial) continue; // every key has this digit; the pass would not move anything
+
+        parallelFor(chunks, chunks, [&](int, int c) {
+            vector<int>& offset = counts[c];
+            int end = min(n, (c + 1) * chunkSize);
+            for (int i = c * chunkSize; i < end; ++i) {
+                int dst = offset[(keys[i] >> shift) & 255]++;
+                keysTmp[dst] = keys[i];
+                orderTmp[dst] = order[i];
+            }
+        });
+        keys.swap(keysTmp);
+        order.swap(orderTmp);
+    }
+    return order;
+}
+
+// Function to sort processes by arrival time (stable), in place by following the permutation's cycles
+void sortByArrival(vector<Process>& processes) {
+    vector<int> order = arrivalOrder(processes); // order[i] = index of the process that belongs at i
+    for (int start = 0; start < (int)order.size(); ++start) {
+        if (order[start] == start) continue;
+        Process held = move(processes[start]);
+        int i = start;
+        while (order[i] != start) {
+            int from = order[i];
+            processes[i] = move(processes[from]);
+            order[i] = i;
+            i = from;
+        }
+        processes[i] = move(held);
+        order[i] = i;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+
+/*
+Hot-path instrumentation. Build with -DSCHED_PROFILE to enable; otherwise COUNT and
+SCOPED_TIMER expand to nothing and the scheduler loops are unchanged.
+  dispatches  - a different process was put on the CPU
+  preemptions - the process leaving the CPU still had work left
+  heapOps     - pushes + pops on ready heaps/queues
+  idleJumps   - idle gaps skipped in one step (event-driven engines)
+  idleTicks   - idle time units stepped one at a time (tick-driven engines)
+  scans       - linear selection scans, scanLength = processes visited by them
+Timers also write begin/end markers to the tracefs trace_marker file so they show up
+as ftrace:print events under `perf record -e ftrace:print` / `perf trace`.
+*/
+#ifdef SCHED_PROFILE
+
+struct SchedCounters {
+    long long dispatches = 0;
+    long long preemptions = 0;
+    long long heapOps = 0;
+    long long idleJumps = 0;
+    long long idleTicks = 0;
+    long long scans = 0;
+    long long scanLength = 0;
+};
+
+struct TimerTotal {
+    const char* name;
+    long long nanoseconds;
+    long long calls;
+};
+
+thread_local SchedCounters schedCounters;
+thread_local vector<TimerTotal> timerTotals;
+
+// Function to write a marker line to the kernel trace buffer (silently skipped when tracefs is not writable)
+void perfMarker(const char* phase, const char* name) {
+    static FILE* marker = []() {
+        FILE* f = fopen("/sys/kernel/tracing/trace_marker", "w");
+        if (!f) f = fopen("/sys/kernel/debug/tracing/trace_marker", "w");
+        return f;
+    }();
+    if (marker) {
+        fprintf(marker, "sched %s %s\n", phase, name);
+        fflush(marker);
+    }
+}
+
+struct ScopedTimer {
+    const char* name;
+    chrono::steady_clock::time_point start;
+
+    explicit ScopedTimer(const char* timerName) : name(timerName), start(chrono::steady_clock::now()) {
+        perfMarker("begin", name);
+    }
+    ~ScopedTimer() {
+        long long elapsed = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+        perfMarker("end", name);
+        for (auto& total : timerTotals) {
+            if (total.name == name) {
+                total.nanoseconds += elapsed;
+                total.calls++;
+                return;
+            }
+        }
+        timerTotals.push_back({name, elapsed, 1});
+    }
+};
+
+#define COUNT(field, amount) (schedCounters.field += (amount))
+#define SCOPED_TIMER_JOIN(a, b) a##b
+#define SCOPED_TIMER_NAME(line) SCOPED_TIMER_JOIN(scopedTimer, line)
+#define SCOPED_TIMER(name) ScopedTimer SCOPED_TIMER_NAME(__LINE__)(name)
+
+// Function to clear the counters of the calling thread before a run
+void resetProfile() {
+    schedCounters = SchedCounters();
+    timerTotals.clear();
+}
+
+// Function to print the per-run profiling report
+void printProfileReport(int processCount) {
+    cout << "Profile (" << processCount << " processes)\n";
+    cout << "  dispatches  : " << schedCounters.dispatches << "\n";
+    cout << "  preemptions : " << schedCounters.preemptions << "\n";
+    cout << "  heap ops    : " << schedCounters.heapOps << "\n";
+    cout << "  idle jumps  : " << schedCounters.idleJumps << "\n";
+    cout << "  idle ticks  : " << schedCounters.idleTicks << "\n";
+    cout << "  scans       : " << schedCounters.scans;
+    if (schedCounters.scans > 0) {
+        cout << " (avg length " << fixed << setprecision(1) << (double)schedCounters.scanLength / schedCounters.scans << ")";
+    }
+    cout << "\n";
+    for (const auto& total : timerTotals) {
+        cout << "  timer " << total.name << ": " << fixed << setprecision(3) << total.nanoseconds / 1e6
+             << " ms over " << total.calls << " call(s)\n";
+    }
+}
+
+#else
+
+#define COUNT(field, amount) ((void)0)
+#define SCOPED_TIMER(name) ((void)0)
+
+void resetProfile() {}
+void printProfileReport(int) {}
+
+#endif // SCHED_PROFILE
+
+///////////////////////////////////////////////////////////////////////////////////////////
+
 // Function to perform First Come First Serve (FCFS) scheduling
 void firstComeFirstServe(vector<Process>& processes) {
+    SCOPED_TIMER("fcfs");
     int time = 0;
     for (auto& process : processes) {
         if (time < process.arrivalTime) {
             time = process.arrivalTime;
+            COUNT(idleJumps, 1);
         }
+        COUNT(dispatches, 1);
+        process.firstStartTime = time;
+        process.responseTime = time - process.arrivalTime;
+        recordSlice(process, time, time + process.burstTime);
         process.completionTime = time + process.burstTime; // CT = t+ BT
         process.turnAroundTime = process.completionTime - process.arrivalTime; // TAT = CT-AT
         process.normTurn = (double)process.turnAroundTime / process.burstTime;  // NT = TAT/BT
@@ -42,6 +377,7 @@ void firstComeFirstServe(vector<Process>& processes) {
 
 // Function to perform Round Robin (RR) scheduling
 void roundRobin(vector<Process>& processes, int slice) {
+    SCOPED_TIMER("rr");
     queue<int> q; // Store process indices
     int currentTime = 0;
     int idx = 0;
@@ -50,11 +386,14 @@ void roundRobin(vector<Process>& processes, int slice) {
     // Initialize remaining times
     for (auto& process : processes) {
         process.remainingTime = process.burstTime;
+        process.firstStartTime = -1;
+        process.preemptions = 0;
     }
 
     // Push all processes that have arrived by time 0
     while (idx < processes.size() && processes[idx].arrivalTime <= currentTime) {
         q.push(idx);
+        COUNT(heapOps, 1);
         idx++;
     }
 
@@ -62,8 +401,12 @@ void roundRobin(vector<Process>& processes, int slice) {
         if (!q.empty()) {
             int processIdx = q.front();
             q.pop();
+            COUNT(heapOps, 1);
+            COUNT(dispatches, 1);
 
+            markDispatch(processes[processIdx], currentTime);
             int executeTime = min(slice, processes[processIdx].remainingTime);
+            recordSlice(processes[processIdx], currentTime, currentTime + executeTime);
             currentTime += executeTime;
             processes[processIdx].remainingTime -= executeTime;
 
@@ -71,10 +414,16 @@ void roundRobin(vector<Process>& processes, int slice) {
                 // Push processes that have arrived during this slice
                 while (idx < processes.size() && processes[idx].arrivalTime <= currentTime) {
                     q.push(idx);
+                    COUNT(heapOps, 1);
                     idx++;
                 }
-                // Re-push the current process as it needs more execution time
+                // Re-push the current process as it needs more execution time; it is preempted if someone else is waiting
+                if (!q.empty()) {
+                    processes[processIdx].preemptions++;
+                    COUNT(preemptions, 1);
+                }
                 q.push(processIdx);
+                COUNT(heapOps, 1);
             } else {
                 processes[processIdx].completionTime = currentTime;
                 processes[processIdx].turnAroundTime = currentTime - processes[processIdx].arrivalTime;
@@ -85,14 +434,17 @@ void roundRobin(vector<Process>& processes, int slice) {
                 // Push processes that have arrived during this slice
                 while (idx < processes.size() && processes[idx].arrivalTime <= currentTime) {
                     q.push(idx);
+                    COUNT(heapOps, 1);
                     idx++;
                 }
             }
         } else {
             currentTime++;
+            COUNT(idleTicks, 1);
             // Push processes that have arrived during the idle time
             while (idx < processes.size() && processes[idx].arrivalTime <= currentTime) {
                 q.push(idx);
+                COUNT(heapOps, 1);
                 idx++;
             }
         }
@@ -106,19 +458,26 @@ void shortestProcessNext(vector<Process>& processes) {
     priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq; // Pair of burst time and process index
     int idx = 0;
     int currentTime = 0;
+    SCOPED_TIMER("spn");
 
     while (idx < processes.size() || !pq.empty()) {
         while (idx < processes.size() && processes[idx].arrivalTime <= currentTime) {
             pq.push(make_pair(processes[idx].burstTime, idx));
+            COUNT(heapOps, 1);
             idx++;
         }
 
         if (!pq.empty()) {
             pair<int, int> top = pq.top();
             pq.pop();
+            COUNT(heapOps, 1);
+            COUNT(dispatches, 1);
             int burstTime = top.first;
             int processIdx = top.second;
+            processes[processIdx].firstStartTime = currentTime;
+            processes[processIdx].responseTime = currentTime - processes[processIdx].arrivalTime;
 
+            recordSlice(processes[processIdx], currentTime, currentTime + burstTime);
             processes[processIdx].completionTime = currentTime + burstTime;
             processes[processIdx].turnAroundTime = processes[processIdx].completionTime - processes[processIdx].arrivalTime;
            
@@ -128,309 +487,2604 @@ void shortestProcessNext(vector<Process>& processes) {
             processes[processIdx].waitingTime=processes[processIdx].turnAroundTime - processes[processIdx].burstTime;
         } else {
             currentTime++;
+            COUNT(idleTicks, 1);
         }
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
 
-// Function to perform Shortest Remaining Time First (SRTF) scheduling
-void shortestRemainingTimeFirst(vector<Process>& processes) {
-    auto compare = [](const pair<int, int>& a, const pair<int, int>& b) {
-        return a.first > b.first; // Min-heap based on remaining time
-    };
+// Timing wheel (I/O wakeups of the event-driven engines)
+/*
+Hierarchical timing wheel: 4 levels of 256 slots cover every non-negative int time.
+An event sits on the level of the highest byte in which its expiry differs from `now`,
+so level 0 holds exact times in the current 256-tick block and higher levels hold
+coarser ranges that are cascaded down when time reaches them. Insert and expire are
+O(1); occupancy bitmaps let the wheel jump over empty stretches instead of ticking.
+*/
+struct TimerWheel {
+    static const int LEVELS = 4;
+    static const int SLOT_BITS = 8;
+    static const int SLOTS = 1 << SLOT_BITS;
+
+    vector<pair<int, int>> slots[LEVELS][SLOTS]; // (expiry time, id)
+    uint64_t occupied[LEVELS][SLOTS / 64] = {};
+    int now = 0; // current time; events at or before it are expired by advance()
+    int pending = 0;
+
+    static int slotIndex(int time, int level) {
+        return (time >> (level * SLOT_BITS)) & (SLOTS - 1);
+    }
 
-    priority_queue<pair<int, int>, vector<pair<int, int>>, decltype(compare)> pq(compare);
-    int currentTime = 0;
-    int completedProcesses = 0;
-    int n = processes.size();
+    void schedule(int expiry, int id) {
+        expiry = max(expiry, now);
+        unsigned differs = (unsigned)(expiry ^ now);
+        int level = 0;
+        while (level < LEVELS - 1 && (differs >> ((level + 1) * SLOT_BITS)) != 0) {
+            level++;
+        }
+        int slot = slotIndex(expiry, level);
+        slots[level][slot].push_back(make_pair(expiry, id));
+        occupied[level][slot / 64] |= 1ULL << (slot % 64);
+        pending++;
+    }
 
-    for (auto& process : processes) {
-        process.remainingTime = process.burstTime;
+    // First occupied slot at `level` with index >= from, or -1
+    int findOccupied(int level, int from) const {
+        for (int word = from / 64; word < SLOTS / 64; ++word) {
+            uint64_t bits = occupied[level][word];
+            if (word == from / 64) bits &= ~0ULL << (from % 64);
+            if (bits) return word * 64 + __builtin_ctzll(bits);
+        }
+        return -1;
     }
 
-    while (completedProcesses < n) {
-        for (int i = 0; i < n; ++i) {
-            if (processes[i].arrivalTime == currentTime) {
-                pq.push(make_pair(processes[i].remainingTime, i));
+    // Empties a slot and re-inserts its events relative to the current time
+    void cascade(int level, int slot) {
+        vector<pair<int, int>> events;
+        events.swap(slots[level][slot]);
+        occupied[level][slot / 64] &= ~(1ULL << (slot % 64));
+        pending -= events.size();
+        for (const auto& event : events) {
+            schedule(event.first, event.second);
+        }
+    }
+
+    // Start time of the next occupied range above level 0, with its level and slot; INT_MAX if none
+    int nextRange(int& level, int& slot) const {
+        for (level = 1; level < LEVELS; ++level) {
+            slot = findOccupied(level, slotIndex(now, level) + 1);
+            if (slot != -1) {
+                int blockBits = (level + 1) * SLOT_BITS;
+                int blockStart = blockBits >= 31 ? 0 : (now >> blockBits) << blockBits;
+                return blockStart | (slot << (level * SLOT_BITS));
             }
         }
+        return INT_MAX;
+    }
 
-        if (!pq.empty()) {
-            int processIdx = pq.top().second;
-            pq.pop();
-            processes[processIdx].remainingTime -= 1;
-            currentTime++;
+    // Expires everything due at or before t, in expiry order, appending (expiry, id) to `expired`
+    void advance(int t, vector<pair<int, int>>& expired) {
+        while (pending > 0) {
+            int slot = findOccupied(0, slotIndex(now, 0));
+            if (slot != -1) {
+                int time = (now & ~(SLOTS - 1)) | slot;
+                if (time > t) break;
+                now = time;
+                expired.insert(expired.end(), slots[0][slot].begin(), slots[0][slot].end());
+                pending -= slots[0][slot].size();
+                slots[0][slot].clear();
+                occupied[0][slot / 64] &= ~(1ULL << (slot % 64));
+                continue;
+            }
+            int level, upper;
+            int start = nextRange(level, upper);
+            if (start > t) break;
+            now = start;
+            cascade(level, upper);
+        }
+        if (t > now) {
+            // Nothing is due before t; move there and bring down the ranges t now falls into
+            now = t;
+            for (int level = LEVELS - 1; level >= 1; --level) {
+                int slot = slotIndex(now, level);
+                if (!slots[level][slot].empty()) cascade(level, slot);
+            }
+        }
+    }
 
-            if (processes[processIdx].remainingTime == 0) {
-                processes[processIdx].completionTime = currentTime;
-                processes[processIdx].turnAroundTime = processes[processIdx].completionTime - processes[processIdx].arrivalTime;
-                processes[processIdx].waitingTime = processes[processIdx].turnAroundTime - processes[processIdx].burstTime;
-                processes[processIdx].normTurn = (double)processes[processIdx].turnAroundTime / processes[processIdx].burstTime;
-                completedProcesses++;
+    // Earliest pending expiry, INT_MAX when nothing is pending
+    int nextExpiry() const {
+        if (pending == 0) return INT_MAX;
+        int slot = findOccupied(0, slotIndex(now, 0));
+        if (slot != -1) return (now & ~(SLOTS - 1)) | slot;
+        int level, upper;
+        if (nextRange(level, upper) == INT_MAX) return INT_MAX;
+        int earliest = INT_MAX;
+        for (const auto& event : slots[level][upper]) {
+            earliest = min(earliest, event.first);
+        }
+        return earliest;
+    }
+};
+
+/*
+CPU / I-O phases of the event-driven schedulers (preemptive engine, CFS). start() makes
+BT the total CPU time and remainingTime the first CPU phase. A process whose CPU phase
+ends blocks in the wheel, and wake() hands it back when its I/O completes, either with
+its next CPU phase loaded or as finished when the last phase was I/O.
+*/
+struct IoPhases {
+    vector<int> phase;  // index into bursts of the current phase
+    TimerWheel blocked; // I/O completions, id = process index
+    vector<pair<int, int>> woken;
+
+    void start(vector<Process>& processes) {
+        phase.assign(processes.size(), 0);
+        for (auto& process : processes) {
+            process.burstTime = cpuTime(process);
+            if (!process.bursts.empty()) process.remainingTime = process.bursts[0];
+            process.ioTime = 0;
+        }
+    }
+
+    // Function to block process i, whose CPU phase ended at `time`; false if no phase is left
+    bool block(vector<Process>& processes, int i, int time) {
+        Process& process = processes[i];
+        if (phase[i] + 1 >= (int)process.bursts.size()) return false;
+        int ioBurst = process.bursts[++phase[i]];
+        process.ioTime += ioBurst;
+        blocked.schedule(time + ioBurst, i);
+        return true;
+    }
+
+    // Function to wake the processes whose I/O ended by `time`: ready(i) or finished(i, end time)
+    template <typename Ready, typename Finished>
+    void wake(vector<Process>& processes, int time, Ready ready, Finished finished) {
+        woken.clear();
+        blocked.advance(time, woken);
+        for (const auto& event : woken) {
+            int i = event.second;
+            if (phase[i] + 1 < (int)processes[i].bursts.size()) {
+                processes[i].remainingTime = processes[i].bursts[++phase[i]];
+                ready(i);
             } else {
-                pq.push(make_pair(processes[processIdx].remainingTime, processIdx));
+                finished(i, event.first);
             }
-        } else {
-            currentTime++;
         }
     }
-}
+};
 
 ///////////////////////////////////////////////////////////////////////////////////////////
 
-// Function to perform Highest Priority (HP) scheduling 
-void highestPriority(vector<Process>& processes) {
+// Event-driven preemptive engine (SRTF, predicted SRTF, EDF[p])
+/*
+Tickless: the running process is kept outside the heap and time jumps straight to the
+next arrival or completion, so heap traffic is O(n + preemptions) instead of one
+pop/push per time unit. Everything that arrives in the same instant is admitted first
+and only then is the best waiting key compared with the running process, so a process
+overtaken within that instant is never counted as dispatched or preempted. A strictly
+smaller key preempts; ties keep the running process. The key of a waiting process must
+not change while it waits (only the running one's may shrink), so heap entries never
+go stale.
+*/
+struct PreemptiveEngine {
+    vector<Process>& processes;
+    function<double(int)> key;      // smaller runs first
+    function<void(int)> onArrival;  // optional, called before the arriving process's key is read
+    function<void(int)> onComplete; // optional, called after the completion fields are set
+    priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>> ready; // (key, index)
     int currentTime = 0;
+    int nextArrival = 0;
+    int running = -1;
     int completedProcesses = 0;
-    int n = processes.size();
+    unique_ptr<IoPhases> io; // CPU / I-O phases, null unless usePhases() was called
 
-    for (auto& process : processes) {
-        process.isCompleted = false;
+    PreemptiveEngine(vector<Process>& processes, function<double(int)> key) : processes(processes), key(key) {
+        for (auto& process : processes) {
+            process.ioTime = 0;
+        }
     }
 
-    while (completedProcesses < n) {
-        int idx = -1;
-        int highestPriority = -1;
+    void enqueue(int i) {
+        ready.push(make_pair(key(i), i));
+        COUNT(heapOps, 1);
+    }
 
-        // Find the highest priority process that has arrived and is not completed
-        for (int i = 0; i < n; ++i) {
-            if (processes[i].arrivalTime <= currentTime && !processes[i].isCompleted) {
-                if (processes[i].priority > highestPriority) {
-                    highestPriority = processes[i].priority;
-                    idx = i;
+    /*
+    Function to run processes with a bursts list as alternating CPU and I/O phases: BT
+    becomes the total CPU time and remainingTime the current CPU phase, so SRTF keys on
+    the next CPU burst. A process that ends a CPU phase blocks in a timing wheel and
+    rejoins the ready heap when its I/O completes. Call after remainingTime is reset.
+    */
+    void usePhases() {
+        io.reset(new IoPhases());
+        io->start(processes);
+    }
+
+    void complete(int i, int time) {
+        Process& process = processes[i];
+        finishProcess(process, time);
+        process.isCompleted = true;
+        completedProcesses++;
+        if (onComplete) onComplete(i);
+    }
+
+    // Function to admit arrivals and I/O completions up to the current time
+    void admit() {
+        int n = processes.size();
+        while (nextArrival < n && processes[nextArrival].arrivalTime <= currentTime) {
+            if (onArrival) onArrival(nextArrival);
+            enqueue(nextArrival);
+            nextArrival++;
+        }
+        if (io) {
+            io->wake(processes, currentTime, [this](int i) { enqueue(i); },
+                     [this](int i, int end) { complete(i, end); });
+        }
+    }
+
+    // Next arrival or I/O completion, INT_MAX if none
+    int nextEvent() const {
+        int next = nextArrival < (int)processes.size() ? processes[nextArrival].arrivalTime : INT_MAX;
+        return io ? min(next, io->blocked.nextExpiry()) : next;
+    }
+
+    // Function to run until every process is done or the clock reaches `until`
+    void run(int until = INT_MAX) {
+        int n = processes.size();
+        while (completedProcesses < n && currentTime < until) {
+            admit();
+            if (running != -1 && !ready.empty() && ready.top().first < key(running)) {
+                processes[running].preemptions++;
+                enqueue(running);
+                running = -1;
+                COUNT(preemptions, 1);
+            }
+
+            if (running == -1) {
+                if (ready.empty()) {
+                    if (completedProcesses == n) break; // the last process ended with I/O
+                    currentTime = nextEvent(); // CPU idle until the next arrival or wakeup
+                    COUNT(idleJumps, 1);
+                    continue;
                 }
+                running = ready.top().second;
+                ready.pop();
+                markDispatch(processes[running], currentTime);
+                COUNT(heapOps, 1);
+                COUNT(dispatches, 1);
             }
-        }
 
-        if (idx != -1) {
-            currentTime += processes[idx].burstTime;
-            processes[idx].completionTime = currentTime;
-            processes[idx].turnAroundTime = processes[idx].completionTime - processes[idx].arrivalTime;
-            processes[idx].waitingTime=processes[idx].turnAroundTime - processes[idx].burstTime;
-            processes[idx].normTurn = (double)processes[idx].turnAroundTime / processes[idx].burstTime;
-            processes[idx].isCompleted = true;
-            completedProcesses++;
-        } else {
-            currentTime++;
+            // Run until the CPU phase ends, the next arrival or wakeup, or `until`, whichever comes first
+            Process& process = processes[running];
+            int runUntil = min(min(currentTime + process.remainingTime, until), nextEvent());
+            recordSlice(process, currentTime, runUntil);
+            process.remainingTime -= runUntil - currentTime;
+            currentTime = runUntil;
+
+            if (process.remainingTime == 0) {
+                int i = running;
+                running = -1;
+                if (!io || !io->block(processes, i, currentTime)) {
+                    complete(i, currentTime);
+                }
+            }
         }
     }
-}
+};
 
 ///////////////////////////////////////////////////////////////////////////////////////////
 
-// Function to perform Highest Priority (Preemptive) scheduling
-void preemptiveHighestPriority(vector<Process>& processes) {
+// Function to perform Shortest Remaining Time First (SRTF) scheduling, on the preemptive engine
+
+// A process that has arrived but not completed, as stored in a checkpoint
+struct ReadyEntry {
+    int index;
+    int remainingTime;
+    int firstStartTime;
+    int preemptions;
+};
+
+/*
+Everything the SRTF loop needs to carry on from a given instant. Completed processes
+are only kept as running totals, so the size depends on the ready set, not the trace.
+*/
+struct SimCheckpoint {
+    int processCount = 0; // size of the trace the checkpoint belongs to
     int currentTime = 0;
+    int nextArrival = 0; // index of the next process to admit (processes are sorted by AT)
     int completedProcesses = 0;
-    int n = processes.size();
+    int running = -1; // index of the process on the CPU, -1 when idle
+    long long totalTurnAround = 0;
+    long long totalWaiting = 0;
+    long long totalResponse = 0;
+    vector<ReadyEntry> ready; // includes the running process
+};
 
-    for (auto& process : processes) {
-        process.remainingTime = process.burstTime;
-        process.isCompleted = false;
+const uint32_t CHECKPOINT_MAGIC = 0x504B4353; // "SCKP"
+const uint32_t CHECKPOINT_VERSION = 1;
+
+// Function to write a checkpoint as a compact binary file (written to a temp file, then renamed)
+bool saveCheckpoint(const SimCheckpoint& state, const string& path) {
+    string tmpPath = path + ".tmp";
+    ofstream out(tmpPath, ios::binary | ios::trunc);
+    if (!out) return false;
+
+    int32_t header[6] = {state.processCount, state.currentTime, state.nextArrival,
+                         state.completedProcesses, state.running, (int32_t)state.ready.size()};
+    int64_t totals[3] = {state.totalTurnAround, state.totalWaiting, state.totalResponse};
+    out.write((const char*)&CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+    out.write((const char*)&CHECKPOINT_VERSION, sizeof(CHECKPOINT_VERSION));
+    out.write((const char*)header, sizeof(header));
+    out.write((const char*)totals, sizeof(totals));
+    for (const auto& entry : state.ready) {
+        int32_t fields[4] = {entry.index, entry.remainingTime, entry.firstStartTime, entry.preemptions};
+        out.write((const char*)fields, sizeof(fields));
     }
+    out.close();
+    if (!out) return false;
+    return rename(tmpPath.c_str(), path.c_str()) == 0;
+}
 
-    while (completedProcesses < n) {
-        int idx = -1;
-        int highestPriority = -1;
-
-        // Find the highest priority process that has arrived and is not completed
-        for (int i = 0; i < n; ++i) {
-            if (processes[i].arrivalTime <= currentTime && !processes[i].isCompleted) {
-                if (processes[i].priority > highestPriority || 
-                   (processes[i].priority == highestPriority && processes[i].arrivalTime < processes[idx].arrivalTime)) {
-                    highestPriority = processes[i].priority;
-                    idx = i;
-                }
-            }
-        }
+// Function to read a checkpoint written by saveCheckpoint
+bool loadCheckpoint(SimCheckpoint& state, const string& path) {
+    ifstream in(path, ios::binary);
+    uint32_t magic = 0, version = 0;
+    int32_t header[6];
+    int64_t totals[3];
+    in.read((char*)&magic, sizeof(magic));
+    in.read((char*)&version, sizeof(version));
+    in.read((char*)header, sizeof(header));
+    in.read((char*)totals, sizeof(totals));
+    if (!in || magic != CHECKPOINT_MAGIC || version != CHECKPOINT_VERSION) return false;
+    // Counts must be consistent before anything is sized from them: the ready set holds
+    // exactly the admitted processes that have not completed
+    if (header[0] < 0 || header[1] < 0 || header[2] < 0 || header[2] > header[0] || header[3] < 0
+        || header[3] > header[2] || header[5] != header[2] - header[3]) {
+        return false;
+    }
 
-        if (idx != -1) {
-            processes[idx].remainingTime -= 1;
-            currentTime++;
+    state.processCount = header[0];
+    state.currentTime = header[1];
+    state.nextArrival = header[2];
+    state.completedProcesses = header[3];
+    state.running = header[4];
+    state.totalTurnAround = totals[0];
+    state.totalWaiting = totals[1];
+    state.totalResponse = totals[2];
+    state.ready.resize(header[5]);
+    vector<bool> seen(state.nextArrival, false);
+    bool runningSeen = state.running == -1;
+    for (auto& entry : state.ready) {
+        int32_t fields[4];
+        in.read((char*)fields, sizeof(fields));
+        entry = {fields[0], fields[1], fields[2], fields[3]};
+        // Every entry must be a distinct admitted process
+        if (!in || entry.index < 0 || entry.index >= state.nextArrival || seen[entry.index]) return false;
+        seen[entry.index] = true;
+        runningSeen = runningSeen || entry.index == state.running;
+    }
+    return (bool)in && runningSeen;
+}
 
-            if (processes[idx].remainingTime == 0) {
-                processes[idx].completionTime = currentTime;
-                processes[idx].turnAroundTime = processes[idx].completionTime - processes[idx].arrivalTime;
-                processes[idx].waitingTime = processes[idx].turnAroundTime - processes[idx].burstTime;
-                processes[idx].normTurn = (double)processes[idx].turnAroundTime / processes[idx].burstTime;
-                processes[idx].isCompleted = true;
-                completedProcesses++;
-            }
-        } else {
-            currentTime++;
+// Function to check that a loaded checkpoint can belong to `processes` (sorted by AT)
+bool checkpointFitsTrace(const SimCheckpoint& state, const vector<Process>& processes) {
+    if (state.processCount != (int)processes.size()) return false;
+    // Everything arriving before the checkpoint time has been admitted
+    if (state.nextArrival < state.processCount && processes[state.nextArrival].arrivalTime < state.currentTime) {
+        return false;
+    }
+    for (const auto& entry : state.ready) {
+        const Process& process = processes[entry.index];
+        if (process.arrivalTime > state.currentTime || entry.remainingTime <= 0
+            || entry.remainingTime > process.burstTime) {
+            return false;
         }
     }
+    return true;
 }
 
-///////////////////////////////////////////////////////////////////////////////////////////
-
-// Function to perform Highest Response Ratio Next (HRRN) scheduling
-void highestResponseRatioNext(vector<Process>& processes) {
-    int currentTime = 0;
-    int completedProcesses = 0;
+/*
+Function to run SRTF starting from `state` (a fresh SimCheckpoint starts at time 0).
+With checkpointInterval > 0 the state is written to checkpointPath every time the
+simulation clock passes another multiple of the interval. With ioPhases a fresh,
+uninterrupted run simulates CPU / I-O phases. Returns the final state.
+*/
+SimCheckpoint runShortestRemainingTimeFirst(vector<Process>& processes, SimCheckpoint state,
+                                            int checkpointInterval = 0, const string& checkpointPath = "",
+                                            bool ioPhases = false) {
+    SCOPED_TIMER("srtf");
     int n = processes.size();
+    // Checkpoints only hold CPU state, so I/O phases are simulated in uninterrupted runs
+    // only; checkpointed and resumed runs schedule each process's total CPU time
+    bool fresh = state.nextArrival == 0 && state.ready.empty();
+    bool phases = ioPhases && checkpointInterval == 0 && fresh;
+    if (!phases) foldPhases(processes);
+    PreemptiveEngine engine(processes, [&processes](int i) { return (double)processes[i].remainingTime; });
+    engine.currentTime = state.currentTime;
+    engine.completedProcesses = state.completedProcesses;
+    engine.nextArrival = state.nextArrival;
+    engine.running = state.running;
+    engine.onComplete = [&](int i) {
+        state.totalTurnAround += processes[i].turnAroundTime;
+        state.totalWaiting += processes[i].waitingTime;
+        state.totalResponse += processes[i].responseTime;
+    };
 
-    for (auto& process : processes) {
+    // Processes before the arrival cursor are done unless the checkpoint lists them as ready
+    for (int i = 0; i < n; ++i) {
+        processes[i].remainingTime = i < engine.nextArrival ? 0 : processes[i].burstTime;
+        processes[i].isCompleted = i < engine.nextArrival;
+        processes[i].preemptions = 0;
+        processes[i].firstStartTime = -1;
+    }
+    for (const auto& entry : state.ready) {
+        Process& process = processes[entry.index];
+        process.remainingTime = entry.remainingTime;
         process.isCompleted = false;
+        process.firstStartTime = entry.firstStartTime;
+        process.responseTime = entry.firstStartTime - process.arrivalTime;
+        process.preemptions = entry.preemptions;
+        if (entry.index != engine.running) {
+            engine.enqueue(entry.index);
+        }
     }
 
-    while (completedProcesses < n) {
-        int idx = -1;
-        double highestResponseRatio = -1.0;
+    // Function to capture the current state; walks the heap storage, not the trace
+    auto capture = [&]() {
+        state.processCount = n;
+        state.currentTime = engine.currentTime;
+        state.nextArrival = engine.nextArrival;
+        state.completedProcesses = engine.completedProcesses;
+        state.running = engine.running;
+        state.ready.clear();
+        if (engine.running != -1) {
+            const Process& p = processes[engine.running];
+            state.ready.push_back({engine.running, p.remainingTime, p.firstStartTime, p.preemptions});
+        }
+        auto heapCopy = engine.ready;
+        while (!heapCopy.empty()) {
+            const Process& p = processes[heapCopy.top().second];
+            state.ready.push_back({heapCopy.top().second, p.remainingTime, p.firstStartTime, p.preemptions});
+            heapCopy.pop();
+        }
+    };
 
-        // Find the process with the highest response ratio that has arrived and is not completed
-        for (int i = 0; i < n; ++i) {
-            if (processes[i].arrivalTime <= currentTime && !processes[i].isCompleted) {
-                int waitingTime = currentTime - processes[i].arrivalTime;
-                double responseRatio = (double)(waitingTime + processes[i].burstTime) / processes[i].burstTime;
+    if (phases) engine.usePhases();
 
-                if (responseRatio > highestResponseRatio) {
-                    highestResponseRatio = responseRatio;
-                    idx = i;
+    if (checkpointInterval > 0) {
+        while (engine.completedProcesses < n) {
+            engine.run((engine.currentTime / checkpointInterval + 1) * checkpointInterval);
+            if (engine.completedProcesses < n) {
+                capture();
+                if (!saveCheckpoint(state, checkpointPath)) {
+                    cout << "Failed to write checkpoint " << checkpointPath << "\n";
                 }
             }
         }
-
-        if (idx != -1) {
-            currentTime += processes[idx].burstTime;
-            processes[idx].completionTime = currentTime;
-            processes[idx].turnAroundTime = processes[idx].completionTime - processes[idx].arrivalTime;
-            processes[idx].waitingTime = processes[idx].turnAroundTime - processes[idx].burstTime;
-            processes[idx].normTurn = (double)processes[idx].turnAroundTime / processes[idx].burstTime;
-            processes[idx].isCompleted = true;
-            completedProcesses++;
-        } else {
-            currentTime++;
-        }
+    } else {
+        engine.run();
     }
+
+    capture();
+    return state;
+}
+
+void shortestRemainingTimeFirst(vector<Process>& processes, bool ioPhases = false) {
+    runShortestRemainingTimeFirst(processes, SimCheckpoint(), 0, "", ioPhases);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////
 
-// Function to perform Longest Remaining Time First(LRTF) scheduling 
-/* 
-Function to find the process with the (largest remaining time) among all available processes at the current time
+// Burst-time prediction for SPN / SRTF
+/*
+Real schedulers do not know the burst in advance. These variants schedule on a per-class
+exponential average of past bursts, tau(n+1) = alpha * t(n) + (1 - alpha) * tau(n),
+updated whenever a process of that class completes. A process takes its class estimate
+when it arrives; completion still uses the true burstTime.
 */
-int findLargestRemainingTime(const vector<Process>& processes, int currentTime) {
-    int maxIndex = -1;
-    int maxRemainingTime = -1;
 
-    for (int i = 0; i < processes.size(); i++) {
-        if (processes[i].arrivalTime <= currentTime && processes[i].remainingTime > maxRemainingTime && !processes[i].isCompleted) {
-            maxRemainingTime = processes[i].remainingTime;
-            maxIndex = i;
+// Open-addressing hash map from job class to its current estimate (linear probing, power-of-two capacity)
+struct ClassPredictors {
+    struct Slot {
+        int jobClass;
+        bool used;
+        double estimate;
+    };
+    vector<Slot> slots;
+    int count = 0;
+    double alpha;
+    double initialEstimate;
+
+    ClassPredictors(double smoothing, double initial) : slots(16, Slot{0, false, 0.0}), alpha(smoothing), initialEstimate(initial) {}
+
+    // Returns the estimate for a class, inserting it with the initial estimate if unseen
+    double& estimate(int jobClass) {
+        if ((count + 1) * 2 > (int)slots.size()) grow();
+        size_t mask = slots.size() - 1;
+        size_t i = ((uint32_t)jobClass * 2654435761u) & mask;
+        while (slots[i].used && slots[i].jobClass != jobClass) {
+            i = (i + 1) & mask;
+        }
+        if (!slots[i].used) {
+            slots[i] = {jobClass, true, initialEstimate};
+            count++;
         }
+        return slots[i].estimate;
     }
-    
-    return maxIndex;
-}
-
-void longestRemainingTimeFirst(vector<Process>& processes) {
-    sort(processes.begin(), processes.end(), compareArrival);
 
-    int currentTime = 0;
-    int totalProcesses = processes.size();
-    int completedProcesses = 0;
-    int prefinalTotal = 0;
+    void observe(int jobClass, int actualBurst) {
+        double& tau = estimate(jobClass);
+        tau = alpha * actualBurst + (1.0 - alpha) * tau;
+    }
 
-    // Initialize remaining times and calculate the total burst time (prefinalTotal)
-    for (auto& process : processes) {
-        process.remainingTime = process.burstTime;
-        process.burstTimeBackup = process.burstTime;
-        process.isCompleted = false;
-        prefinalTotal += process.burstTime;
+    void grow() {
+        vector<Slot> old;
+        old.swap(slots);
+        slots.assign(old.size() * 2, Slot{0, false, 0.0});
+        count = 0;
+        for (const auto& slot : old) {
+            if (slot.used) estimate(slot.jobClass) = slot.estimate;
+        }
     }
+};
 
-    while (completedProcesses < totalProcesses) {
-        int index = findLargestRemainingTime(processes, currentTime);
+// Function to finish a process in the prediction-based schedulers and feed its burst back to its class
+void completePredicted(Process& process, int currentTime, ClassPredictors& predictors) {
+    process.completionTime = currentTime;
+    process.turnAroundTime = process.completionTime - process.arrivalTime;
+    process.waitingTime = process.turnAroundTime - process.burstTime;
+    process.normTurn = (double)process.turnAroundTime / process.burstTime;
+    process.isCompleted = true;
+    predictors.observe(process.jobClass, process.burstTime);
+}
 
-        if (index != -1) {
-           
+// Function to perform Shortest Process Next on predicted bursts (non-preemptive)
+void predictedShortestProcessNext(vector<Process>& processes, double alpha, double initialEstimate) {
+    SCOPED_TIMER("spn-predicted");
+    ClassPredictors predictors(alpha, initialEstimate);
+    priority_queue<pair<double, int>, vector<pair<double, int>>, greater<pair<double, int>>> pq; // (estimate, index)
+    int n = processes.size();
+    int idx = 0;
+    int currentTime = 0;
+
+    while (idx < n || !pq.empty()) {
+        if (pq.empty() && currentTime < processes[idx].arrivalTime) {
+            currentTime = processes[idx].arrivalTime;
+            COUNT(idleJumps, 1);
+        }
+        while (idx < n && processes[idx].arrivalTime <= currentTime) {
+            processes[idx].predictedBurst = predictors.estimate(processes[idx].jobClass);
+            pq.push(make_pair(processes[idx].predictedBurst, idx));
+            COUNT(heapOps, 1);
+            idx++;
+        }
+
+        int processIdx = pq.top().second;
+        pq.pop();
+        COUNT(heapOps, 1);
+        COUNT(dispatches, 1);
+        processes[processIdx].firstStartTime = currentTime;
+        processes[processIdx].responseTime = currentTime - processes[processIdx].arrivalTime;
+        recordSlice(processes[processIdx], currentTime, currentTime + processes[processIdx].burstTime);
+        currentTime += processes[processIdx].burstTime;
+        completePredicted(processes[processIdx], currentTime, predictors);
+    }
+}
+
+// Function to perform Shortest Remaining Time First on predicted bursts (on the preemptive engine, like SRTF)
+void predictedShortestRemainingTimeFirst(vector<Process>& processes, double alpha, double initialEstimate) {
+    SCOPED_TIMER("srtf-predicted");
+    ClassPredictors predictors(alpha, initialEstimate);
+
+    for (auto& process : processes) {
+        process.remainingTime = process.burstTime;
+        process.preemptions = 0;
+        process.firstStartTime = -1;
+    }
+    // Key: estimated remaining time, the prediction minus what already ran, never below zero
+    PreemptiveEngine engine(processes, [&processes](int i) {
+        return max(0.0, processes[i].predictedBurst - (processes[i].burstTime - processes[i].remainingTime));
+    });
+    engine.onArrival = [&](int i) { processes[i].predictedBurst = predictors.estimate(processes[i].jobClass); };
+    engine.onComplete = [&](int i) { predictors.observe(processes[i].jobClass, processes[i].burstTime); };
+    engine.run();
+}
+
+// Function to print how far the predictions were from the true bursts
+void printPredictionError(const vector<Process>& processes) {
+    double totalError = 0;
+    for (const auto& process : processes) {
+        totalError += fabs(process.predictedBurst - process.burstTime);
+    }
+    cout << "Mean absolute burst prediction error: " << fixed << setprecision(2) << totalError / processes.size() << "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+
+// Earliest Deadline First (EDF) scheduling
+/*
+deadline is an absolute time; 0 means the process has no deadline and is ordered after
+every process that has one. Both variants are event-driven: a heap keyed by
+(deadline, index) and time jumps to the next arrival or completion.
+*/
+inline int effectiveDeadline(const Process& process) {
+    return process.deadline > 0 ? process.deadline : INT_MAX;
+}
+
+// Function to perform non-preemptive EDF scheduling
+void earliestDeadlineFirst(vector<Process>& processes) {
+    SCOPED_TIMER("edf");
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq; // (deadline, index)
+    int n = processes.size();
+    int idx = 0;
+    int currentTime = 0;
+
+    while (idx < n || !pq.empty()) {
+        if (pq.empty() && currentTime < processes[idx].arrivalTime) {
+            currentTime = processes[idx].arrivalTime;
+            COUNT(idleJumps, 1);
+        }
+        while (idx < n && processes[idx].arrivalTime <= currentTime) {
+            pq.push(make_pair(effectiveDeadline(processes[idx]), idx));
+            COUNT(heapOps, 1);
+            idx++;
+        }
+
+        int processIdx = pq.top().second;
+        pq.pop();
+        COUNT(heapOps, 1);
+        COUNT(dispatches, 1);
+        processes[processIdx].firstStartTime = currentTime;
+        processes[processIdx].responseTime = currentTime - processes[processIdx].arrivalTime;
+        recordSlice(processes[processIdx], currentTime, currentTime + processes[processIdx].burstTime);
+        currentTime += processes[processIdx].burstTime;
+        processes[processIdx].completionTime = currentTime;
+        processes[processIdx].turnAroundTime = processes[processIdx].completionTime - processes[processIdx].arrivalTime;
+        processes[processIdx].waitingTime = processes[processIdx].turnAroundTime - processes[processIdx].burstTime;
+        processes[processIdx].normTurn = (double)processes[processIdx].turnAroundTime / processes[processIdx].burstTime;
+    }
+}
+
+// Function to perform preemptive EDF scheduling on the preemptive engine (a strictly earlier deadline preempts)
+void preemptiveEarliestDeadlineFirst(vector<Process>& processes, bool ioPhases = false) {
+    SCOPED_TIMER("edf-preemptive");
+    for (auto& process : processes) {
+        process.remainingTime = process.burstTime;
+        process.preemptions = 0;
+        process.firstStartTime = -1;
+    }
+    PreemptiveEngine engine(processes, [&processes](int i) { return (double)effectiveDeadline(processes[i]); });
+    if (ioPhases) {
+        engine.usePhases();
+    }
+    engine.run();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+
+// Completely Fair Scheduler (CFS) style weighted fair scheduling
+/*
+Each process accrues virtual runtime at a rate inversely proportional to its weight,
+and the process with the smallest vruntime runs next. Weights come from the Linux
+nice-to-weight table with nice = -priority (clamped to [-20, 19]), so a higher priority
+gets a larger share instead of running to completion ahead of everyone else. The ready
+set is a red-black tree (std::set) ordered by (vruntime, index).
+*/
+const int NICE_0_WEIGHT = 1024;
+const int PRIO_TO_WEIGHT[40] = {
+    /* -20 */ 88761, 71755, 56483, 46273, 36291,
+    /* -15 */ 29154, 23254, 18705, 14949, 11916,
+    /* -10 */ 9548, 7620, 6100, 4904, 3906,
+    /*  -5 */ 3121, 2501, 1991, 1586, 1277,
+    /*   0 */ 1024, 820, 655, 526, 423,
+    /*   5 */ 335, 272, 215, 172, 137,
+    /*  10 */ 110, 87, 70, 56, 45,
+    /*  15 */ 36, 29, 23, 18, 15,
+};
+
+int cfsWeight(int priority) {
+    int nice = max(-20, min(19, -priority));
+    return PRIO_TO_WEIGHT[nice + 20];
+}
+
+// Function to perform CFS scheduling; latency is the target period, minGranularity the shortest slice
+void completelyFairScheduler(vector<Process>& processes, int schedLatency, int minGranularity, bool ioPhases = false) {
+    SCOPED_TIMER("cfs");
+    // vruntime is kept in 1/1024 time units so low weights do not round to zero
+    const long long VRUNTIME_SCALE = 1024;
+    set<pair<long long, int>> tree; // (vruntime, index)
+    int n = processes.size();
+    vector<long long> vruntime(n, 0);
+    vector<int> weight(n);
+    long long minVruntime = 0;
+    long long totalWeight = 0; // weights of every runnable process, including the running one
+    int nrRunning = 0;
+    int idx = 0;
+    int currentTime = 0;
+    int completedProcesses = 0;
+    int running = -1;
+    int sliceEnd = 0;
+    minGranularity = max(1, minGranularity);
+
+    for (int i = 0; i < n; ++i) {
+        processes[i].remainingTime = processes[i].burstTime;
+        processes[i].preemptions = 0;
+        processes[i].firstStartTime = -1;
+        processes[i].ioTime = 0;
+        weight[i] = cfsWeight(processes[i].priority);
+    }
+
+    // CPU / I-O phases: a process blocks in the wheel between CPU phases and leaves the runqueue meanwhile
+    unique_ptr<IoPhases> io;
+    if (ioPhases) {
+        io.reset(new IoPhases());
+        io->start(processes);
+    }
+    auto complete = [&](int i, int time) {
+        finishProcess(processes[i], time);
+        completedProcesses++;
+    };
+    auto enqueue = [&](int i) {
+        tree.insert(make_pair(vruntime[i], i));
+        totalWeight += weight[i];
+        nrRunning++;
+        COUNT(heapOps, 1);
+    };
+
+    auto admitArrivals = [&]() {
+        while (idx < n && processes[idx].arrivalTime <= currentTime) {
+            vruntime[idx] = minVruntime; // new processes start level with the queue, not at 0
+            enqueue(idx);
+            idx++;
+        }
+        if (!io) return;
+        io->wake(processes, currentTime, [&](int i) {
+            // Sleeper credit of half a period, as in Linux, without moving anyone backwards
+            vruntime[i] = max(vruntime[i], minVruntime - (long long)schedLatency * VRUNTIME_SCALE / 2);
+            enqueue(i);
+        }, complete);
+    };
+    // Next arrival or I/O completion, INT_MAX if none
+    auto nextEvent = [&]() {
+        int next = idx < n ? processes[idx].arrivalTime : INT_MAX;
+        return io ? min(next, io->blocked.nextExpiry()) : next;
+    };
+    // Slice = weight's share of the scheduling period, never below the minimum granularity
+    auto timeslice = [&](int i) {
+        long long period = max<long long>(schedLatency, (long long)nrRunning * minGranularity);
+        return (int)max<long long>(minGranularity, period * weight[i] / totalWeight);
+    };
+
+    while (completedProcesses < n) {
+        admitArrivals();
+
+        if (running == -1) {
+            if (tree.empty()) {
+                if (completedProcesses == n) break; // the last process ended with I/O
+                currentTime = nextEvent(); // CPU idle until the next arrival or wakeup
+                COUNT(idleJumps, 1);
+                continue;
+            }
+            running = tree.begin()->second;
+            tree.erase(tree.begin());
+            sliceEnd = currentTime + timeslice(running);
+            markDispatch(processes[running], currentTime);
+            COUNT(heapOps, 1);
+            COUNT(dispatches, 1);
+        }
+
+        // Run until the CPU phase ends, end of slice or the next arrival or wakeup
+        int runUntil = min(min(currentTime + processes[running].remainingTime, sliceEnd), nextEvent());
+        int delta = runUntil - currentTime;
+        recordSlice(processes[running], currentTime, runUntil);
+        processes[running].remainingTime -= delta;
+        vruntime[running] += (long long)delta * NICE_0_WEIGHT * VRUNTIME_SCALE / weight[running];
+        currentTime = runUntil;
+
+        // min_vruntime only moves forward
+        long long leftmost = tree.empty() ? vruntime[running] : min(vruntime[running], tree.begin()->first);
+        minVruntime = max(minVruntime, leftmost);
+
+        if (processes[running].remainingTime == 0) {
+            totalWeight -= weight[running];
+            nrRunning--;
+            if (!io || !io->block(processes, running, currentTime)) {
+                complete(running, currentTime);
+            }
+            running = -1;
+            continue;
+        }
+
+        bool preempt = currentTime >= sliceEnd;
+        if (!preempt) {
+            // Wakeup preemption: an arrival that is more than one granularity behind takes over
+            admitArrivals();
+            long long wakeupGranularity = (long long)minGranularity * NICE_0_WEIGHT * VRUNTIME_SCALE / weight[running];
+            preempt = !tree.empty() && tree.begin()->first + wakeupGranularity < vruntime[running];
+        }
+        if (preempt && !tree.empty()) {
+            tree.insert(make_pair(vruntime[running], running));
+            processes[running].preemptions++;
+            COUNT(heapOps, 1);
+            COUNT(preemptions, 1);
+            running = -1;
+        } else if (preempt) {
+            sliceEnd = currentTime + timeslice(running); // alone on the CPU: start a fresh slice
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+
+// CPU / I-O burst simulation
+/*
+A process with a non-empty `bursts` list alternates CPU and I/O phases
+(CPU, I/O, CPU, ...); without one it is a single CPU burst of burstTime. When a CPU
+phase ends the process blocks until its I/O finishes and then re-enters the ready
+queue of the selected policy. ioBurstScheduler covers FCFS, RR, SPN and HP, with
+arrivals and I/O wakeups both coming from one timing wheel; the preemptive engine
+(SRTF, EDF[p]) and CFS keep their arrival cursor and block processes in a wheel of
+their own. The tick-driven column scans (HP[p], HRRN, LRTF) have no event source to
+wake a blocked process from and stay CPU-only; HP covers priority scheduling with I/O.
+*/
+
+// Function to return CPU busy time (total BT) over the time from the first arrival to the last completion
+double cpuUtilization(const vector<Process>& processes) {
+    long long busyTime = 0;
+    int firstArrival = INT_MAX, lastCompletion = 0;
+    for (const auto& process : processes) {
+        busyTime += process.burstTime;
+        firstArrival = min(firstArrival, process.arrivalTime);
+        lastCompletion = max(lastCompletion, process.completionTime);
+    }
+    return lastCompletion > firstArrival ? (double)busyTime / (lastCompletion - firstArrival) : 0.0;
+}
+
+/*
+Function to run the CPU/I-O simulation under one ready-queue policy, using the menu
+numbers: 1 = FCFS, 2 = RR (with slice), 3 = SPN on the next CPU phase, 5 = Highest
+Priority. All are non-preemptive apart from the RR quantum. The preemptive policies
+(SRTF, EDF[p], CFS) simulate phases on their own engines instead. Returns the CPU
+utilization.
+*/
+double ioBurstScheduler(vector<Process>& processes, int policy, int slice) {
+    SCOPED_TIMER("io-bursts");
+    // Ready entries ordered by (policy key, time it became ready, sequence number, index)
+    typedef tuple<long long, int, long long, int> ReadyKey;
+    priority_queue<ReadyKey, vector<ReadyKey>, greater<ReadyKey>> ready;
+    TimerWheel events; // id = 2 * index for an arrival, 2 * index + 1 for an I/O completion
+    vector<pair<int, int>> due;
+    int n = processes.size();
+    vector<int> phase(n, 0); // index into bursts of the current phase
+    vector<int> phaseRemaining(n);
+    long long sequence = 0;
+    int currentTime = 0;
+    int completedProcesses = 0;
+    int running = -1;
+
+    for (int i = 0; i < n; ++i) {
+        Process& process = processes[i];
+        events.schedule(process.arrivalTime, 2 * i);
+        process.burstTime = cpuTime(process);
+        phaseRemaining[i] = process.bursts.empty() ? process.burstTime : process.bursts[0];
+        process.ioTime = 0;
+        process.preemptions = 0;
+        process.firstStartTime = -1;
+    }
+
+    auto enqueue = [&](int i, int readyTime) {
+        long long key = 0;
+        if (policy == 3) key = phaseRemaining[i];
+        else if (policy == 5) key = -processes[i].priority;
+        ready.push(make_tuple(key, readyTime, sequence++, i));
+        COUNT(heapOps, 1);
+    };
+    auto complete = [&](int i, int time) {
+        finishProcess(processes[i], time);
+        completedProcesses++;
+    };
+    // Arrivals and I/O completions up to currentTime join the ready queue, stamped with their own time
+    auto admit = [&]() {
+        due.clear();
+        events.advance(currentTime, due);
+        for (const auto& event : due) {
+            int i = event.second / 2;
+            if (event.second % 2 == 0) {
+                enqueue(i, event.first);
+            } else if (phase[i] + 1 < (int)processes[i].bursts.size()) {
+                phase[i]++;
+                phaseRemaining[i] = processes[i].bursts[phase[i]];
+                enqueue(i, event.first);
+            } else {
+                complete(i, event.first); // the last phase was I/O
+            }
+        }
+    };
+
+    while (completedProcesses < n) {
+        admit();
+
+        if (running == -1) {
+            if (ready.empty()) {
+                currentTime = events.nextExpiry(); // CPU idle until the next event
+                COUNT(idleJumps, 1);
+                continue;
+            }
+            running = get<3>(ready.top());
+            ready.pop();
+            markDispatch(processes[running], currentTime);
+            COUNT(heapOps, 1);
+            COUNT(dispatches, 1);
+        }
+
+        int runFor = policy == 2 ? min(slice, phaseRemaining[running]) : phaseRemaining[running];
+        recordSlice(processes[running], currentTime, currentTime + runFor);
+        phaseRemaining[running] -= runFor;
+        currentTime += runFor;
+        admit(); // everything that became ready during the run queues ahead of a preempted process
+
+        Process& process = processes[running];
+        if (phaseRemaining[running] > 0 && ready.empty()) {
+            continue; // quantum expired with nobody waiting: keep the CPU, as in roundRobin
+        } else if (phaseRemaining[running] > 0) {
+            process.preemptions++;
+            COUNT(preemptions, 1);
+            enqueue(running, currentTime);
+        } else if (phase[running] + 1 < (int)process.bursts.size()) {
+            phase[running]++;
+            int ioBurst = process.bursts[phase[running]];
+            process.ioTime += ioBurst;
+            events.schedule(currentTime + ioBurst, 2 * running + 1);
+        } else {
+            complete(running, currentTime);
+        }
+        running = -1;
+    }
+
+    return cpuUtilization(processes);
+}
+
+// Function to print the I/O time per process and the CPU utilization of an I/O burst run
+void printIoStats(const vector<Process>& processes, double utilization) {
+    cout << "IO       |";
+    long long totalIo = 0;
+    for (const auto& process : processes) {
+        cout << "" << setw(3) << process.ioTime << " |";
+        totalIo += process.ioTime;
+    }
+    cout << "" << fixed << setprecision(2) << (double)totalIo / processes.size() << " |\n";
+    cout << "CPU utilization: " << fixed << setprecision(2) << utilization * 100 << "%\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+
+// Column (SoA) copy of the fields read by the scan-based selection loops
+// (HP, HP[p], HRRN, LRTF). Kept in sync by the schedulers so the argmax scans
+// below can run over contiguous int arrays instead of striding through Process.
+struct ProcessColumns {
+    vector<int> arrival;
+    vector<int> burst;
+    vector<int> priority;
+    vector<int> remaining;
+    vector<int> done; // 0 = not completed, -1 = completed (all-ones lane mask)
+};
+
+ProcessColumns makeColumns(const vector<Process>& processes) {
+    ProcessColumns cols;
+    int n = processes.size();
+    cols.arrival.resize(n);
+    cols.burst.resize(n);
+    cols.priority.resize(n);
+    cols.remaining.resize(n);
+    cols.done.assign(n, 0);
+    for (int i = 0; i < n; ++i) {
+        cols.arrival[i] = processes[i].arrivalTime;
+        cols.burst[i] = processes[i].burstTime;
+        cols.priority[i] = processes[i].priority;
+        cols.remaining[i] = processes[i].burstTime;
+    }
+    return cols;
+}
+
+/*
+Selection kernels. Every kernel only looks at processes that have arrived
+(arrival <= currentTime) and are not completed, and reproduces the tie-break
+of the scalar loop it replaces:
+  maxKey               - largest key (> -1), first index wins            (HP, LRTF)
+  maxPriorityEarliest  - largest priority (> -1), then earliest arrival,
+                         then first index                                 (HP[p])
+  maxResponseRatio     - largest (wait + burst) / burst, first index wins (HRRN)
+They return -1 when nothing is eligible.
+*/
+struct SelectionKernels {
+    int (*maxKey)(const int* key, const int* arrival, const int* done, int n, int currentTime);
+    int (*maxPriorityEarliest)(const int* priority, const int* arrival, const int* done, int n, int currentTime);
+    int (*maxResponseRatio)(const int* burst, const int* arrival, const int* done, int n, int currentTime);
+    const char* name;
+};
+
+int maxKeyScalar(const int* key, const int* arrival, const int* done, int n, int currentTime) {
+    int best = -1, idx = -1;
+    for (int i = 0; i < n; ++i) {
+        if (arrival[i] <= currentTime && !done[i] && key[i] > best) {
+            best = key[i];
+            idx = i;
+        }
+    }
+    return idx;
+}
+
+int maxPriorityEarliestScalar(const int* priority, const int* arrival, const int* done, int n, int currentTime) {
+    int best = -1, idx = -1;
+    for (int i = 0; i < n; ++i) {
+        if (arrival[i] <= currentTime && !done[i]) {
+            if (priority[i] > best || (priority[i] == best && arrival[i] < arrival[idx])) {
+                best = priority[i];
+                idx = i;
+            }
+        }
+    }
+    return idx;
+}
+
+int maxResponseRatioScalar(const int* burst, const int* arrival, const int* done, int n, int currentTime) {
+    double best = -1.0;
+    int idx = -1;
+    for (int i = 0; i < n; ++i) {
+        if (arrival[i] <= currentTime && !done[i]) {
+            int waitingTime = currentTime - arrival[i];
+            double responseRatio = (double)(waitingTime + burst[i]) / burst[i];
+            if (responseRatio > best) {
+                best = responseRatio;
+                idx = i;
+            }
+        }
+    }
+    return idx;
+}
+
+#ifdef SCHED_HAVE_X86
+
+__attribute__((target("avx2")))
+static int hmaxEpi32(__m256i v) {
+    __m128i m = _mm_max_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    m = _mm_max_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+    m = _mm_max_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(m);
+}
+
+__attribute__((target("avx2")))
+static int hminEpi32(__m256i v) {
+    __m128i m = _mm_min_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+    m = _mm_min_epi32(m, _mm_shuffle_epi32(m, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(m);
+}
+
+// All-ones lanes for processes that have not arrived yet or are already completed
+__attribute__((target("avx2")))
+static inline __m256i ineligibleMask(const int* arrival, const int* done, int i, __m256i vt) {
+    __m256i a = _mm256_loadu_si256((const __m256i*)(arrival + i));
+    __m256i d = _mm256_loadu_si256((const __m256i*)(done + i));
+    return _mm256_or_si256(_mm256_cmpgt_epi32(a, vt), d);
+}
+
+__attribute__((target("avx2")))
+int maxKeyAvx2(const int* key, const int* arrival, const int* done, int n, int currentTime) {
+    const __m256i vt = _mm256_set1_epi32(currentTime);
+    const __m256i none = _mm256_set1_epi32(-1);
+    __m256i vbest = none;
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i k = _mm256_loadu_si256((const __m256i*)(key + i));
+        vbest = _mm256_max_epi32(vbest, _mm256_blendv_epi8(k, none, ineligibleMask(arrival, done, i, vt)));
+    }
+    int best = hmaxEpi32(vbest);
+    for (; i < n; ++i) {
+        if (arrival[i] <= currentTime && !done[i] && key[i] > best) best = key[i];
+    }
+    if (best == -1) return -1;
+
+    // Second pass: first eligible lane holding the maximum
+    const __m256i vb = _mm256_set1_epi32(best);
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256i k = _mm256_loadu_si256((const __m256i*)(key + i));
+        __m256i hit = _mm256_andnot_si256(ineligibleMask(arrival, done, i, vt), _mm256_cmpeq_epi32(k, vb));
+        int bits = _mm256_movemask_ps(_mm256_castsi256_ps(hit));
+        if (bits) return i + __builtin_ctz(bits);
+    }
+    for (; i < n; ++i) {
+        if (arrival[i] <= currentTime && !done[i] && key[i] == best) return i;
+    }
+    return -1;
+}
+
+__attribute__((target("avx2")))
+int maxPriorityEarliestAvx2(const int* priority, const int* arrival, const int* done, int n, int currentTime) {
+    int best = -1;
+    int idx = maxKeyAvx2(priority, arrival, done, n, currentTime);
+    if (idx == -1) return -1;
+    best = priority[idx];
+
+    // Earliest arrival among the eligible processes holding the best priority
+    const __m256i vt = _mm256_set1_epi32(currentTime);
+    const __m256i vb = _mm256_set1_epi32(best);
+    const __m256i late = _mm256_set1_epi32(INT_MAX);
+    __m256i vmin = late;
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i p = _mm256_loadu_si256((const __m256i*)(priority + i));
+        __m256i a = _mm256_loadu_si256((const __m256i*)(arrival + i));
+        __m256i hit = _mm256_andnot_si256(ineligibleMask(arrival, done, i, vt), _mm256_cmpeq_epi32(p, vb));
+        vmin = _mm256_min_epi32(vmin, _mm256_blendv_epi8(late, a, hit));
+    }
+    int earliest = hminEpi32(vmin);
+    for (; i < n; ++i) {
+        if (arrival[i] <= currentTime && !done[i] && priority[i] == best && arrival[i] < earliest) earliest = arrival[i];
+    }
+    if (arrival[idx] == earliest) return idx;
+
+    const __m256i ve = _mm256_set1_epi32(earliest);
+    for (i = idx; i + 8 <= n; i += 8) {
+        __m256i p = _mm256_loadu_si256((const __m256i*)(priority + i));
+        __m256i a = _mm256_loadu_si256((const __m256i*)(arrival + i));
+        __m256i hit = _mm256_and_si256(_mm256_cmpeq_epi32(p, vb), _mm256_cmpeq_epi32(a, ve));
+        hit = _mm256_andnot_si256(_mm256_loadu_si256((const __m256i*)(done + i)), hit);
+        int bits = _mm256_movemask_ps(_mm256_castsi256_ps(hit));
+        if (bits) return i + __builtin_ctz(bits);
+    }
+    for (; i < n; ++i) {
+        if (!done[i] && priority[i] == best && arrival[i] == earliest) return i;
+    }
+    return idx;
+}
+
+__attribute__((target("avx2")))
+int maxResponseRatioAvx2(const int* burst, const int* arrival, const int* done, int n, int currentTime) {
+    const __m128i vt = _mm_set1_epi32(currentTime);
+    const __m256d none = _mm256_set1_pd(-1.0);
+    __m256d vbest = none;
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(arrival + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(burst + i));
+        __m128i d = _mm_loadu_si128((const __m128i*)(done + i));
+        __m128i skip = _mm_or_si128(_mm_cmpgt_epi32(a, vt), d);
+        // (double)(waitingTime + burst) / burst, computed exactly as the scalar loop does
+        __m256d ratio = _mm256_div_pd(_mm256_cvtepi32_pd(_mm_add_epi32(_mm_sub_epi32(vt, a), b)), _mm256_cvtepi32_pd(b));
+        ratio = _mm256_blendv_pd(ratio, none, _mm256_castsi256_pd(_mm256_cvtepi32_epi64(skip)));
+        // Take a lane only if it is strictly greater, so a 0/0 (NaN) lane is ignored as in the scalar loop
+        vbest = _mm256_blendv_pd(vbest, ratio, _mm256_cmp_pd(ratio, vbest, _CMP_GT_OQ));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, vbest);
+    double best = max(max(lanes[0], lanes[1]), max(lanes[2], lanes[3]));
+    int idx = -1;
+    for (int j = i; j < n; ++j) {
+        if (arrival[j] <= currentTime && !done[j]) {
+            double responseRatio = (double)(currentTime - arrival[j] + burst[j]) / burst[j];
+            if (responseRatio > best) {
+                best = responseRatio;
+                idx = j;
+            }
+        }
+    }
+    if (idx != -1) return idx; // the tail beat every vector lane
+    if (best == -1.0) return -1;
+
+    const __m256d vb = _mm256_set1_pd(best);
+    for (int j = 0; j + 4 <= i; j += 4) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(arrival + j));
+        __m128i b = _mm_loadu_si128((const __m128i*)(burst + j));
+        __m128i d = _mm_loadu_si128((const __m128i*)(done + j));
+        __m128i skip = _mm_or_si128(_mm_cmpgt_epi32(a, vt), d);
+        __m256d ratio = _mm256_div_pd(_mm256_cvtepi32_pd(_mm_add_epi32(_mm_sub_epi32(vt, a), b)), _mm256_cvtepi32_pd(b));
+        __m256d hit = _mm256_andnot_pd(_mm256_castsi256_pd(_mm256_cvtepi32_epi64(skip)), _mm256_cmp_pd(ratio, vb, _CMP_EQ_OQ));
+        int bits = _mm256_movemask_pd(hit);
+        if (bits) return j + __builtin_ctz(bits);
+    }
+    return -1;
+}
+
+#endif // SCHED_HAVE_X86
+
+const SelectionKernels scalarKernels = {maxKeyScalar, maxPriorityEarliestScalar, maxResponseRatioScalar, "scalar"};
+
+// Picks the widest kernel set the running CPU supports
+SelectionKernels detectKernels() {
+#ifdef SCHED_HAVE_X86
+    if (__builtin_cpu_supports("avx2")) {
+        return {maxKeyAvx2, maxPriorityEarliestAvx2, maxResponseRatioAvx2, "avx2"};
+    }
+#endif
+    return scalarKernels;
+}
+
+SelectionKernels activeKernels = detectKernels();
+
+///////////////////////////////////////////////////////////////////////////////////////////
+
+// Function to perform Highest Priority (HP) scheduling 
+void highestPriority(vector<Process>& processes) {
+    SCOPED_TIMER("hp");
+    int currentTime = 0;
+    int completedProcesses = 0;
+    int n = processes.size();
+
+    for (auto& process : processes) {
+        process.isCompleted = false;
+    }
+    ProcessColumns cols = makeColumns(processes);
+
+    while (completedProcesses < n) {
+        // Find the highest priority process that has arrived and is not completed
+        int idx = activeKernels.maxKey(cols.priority.data(), cols.arrival.data(), cols.done.data(), n, currentTime);
+        COUNT(scans, 1);
+        COUNT(scanLength, n);
+
+        if (idx != -1) {
+            COUNT(dispatches, 1);
+            processes[idx].firstStartTime = currentTime;
+            processes[idx].responseTime = currentTime - processes[idx].arrivalTime;
+            recordSlice(processes[idx], currentTime, currentTime + processes[idx].burstTime);
+            currentTime += processes[idx].burstTime;
+            processes[idx].completionTime = currentTime;
+            processes[idx].turnAroundTime = processes[idx].completionTime - processes[idx].arrivalTime;
+            processes[idx].waitingTime=processes[idx].turnAroundTime - processes[idx].burstTime;
+            processes[idx].normTurn = (double)processes[idx].turnAroundTime / processes[idx].burstTime;
+            processes[idx].isCompleted = true;
+            cols.done[idx] = -1;
+            completedProcesses++;
+        } else {
+            currentTime++;
+            COUNT(idleTicks, 1);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+
+// Function to perform Highest Priority (Preemptive) scheduling
+void preemptiveHighestPriority(vector<Process>& processes) {
+    SCOPED_TIMER("hp-preemptive");
+    int currentTime = 0;
+    int completedProcesses = 0;
+    int n = processes.size();
+
+    for (auto& process : processes) {
+        process.remainingTime = process.burstTime;
+        process.isCompleted = false;
+        process.firstStartTime = -1;
+        process.preemptions = 0;
+    }
+    ProcessColumns cols = makeColumns(processes);
+    int lastIdx = -1; // process that ran in the previous tick
+
+    while (completedProcesses < n) {
+        // Find the highest priority process that has arrived and is not completed (earliest arrival on ties)
+        int idx = activeKernels.maxPriorityEarliest(cols.priority.data(), cols.arrival.data(), cols.done.data(), n, currentTime);
+        COUNT(scans, 1);
+        COUNT(scanLength, n);
+
+        if (idx != -1) {
+            if (idx != lastIdx) {
+                COUNT(dispatches, 1);
+                if (lastIdx != -1 && !processes[lastIdx].isCompleted) {
+                    processes[lastIdx].preemptions++;
+                    COUNT(preemptions, 1);
+                }
+                lastIdx = idx;
+            }
+            markDispatch(processes[idx], currentTime);
+            recordSlice(processes[idx], currentTime, currentTime + 1);
+            processes[idx].remainingTime -= 1;
+            currentTime++;
+
+            if (processes[idx].remainingTime == 0) {
+                processes[idx].completionTime = currentTime;
+                processes[idx].turnAroundTime = processes[idx].completionTime - processes[idx].arrivalTime;
+                processes[idx].waitingTime = processes[idx].turnAroundTime - processes[idx].burstTime;
+                processes[idx].normTurn = (double)processes[idx].turnAroundTime / processes[idx].burstTime;
+                processes[idx].isCompleted = true;
+                cols.done[idx] = -1;
+                completedProcesses++;
+            }
+        } else {
+            currentTime++;
+            COUNT(idleTicks, 1);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+
+// Function to perform Highest Response Ratio Next (HRRN) scheduling
+void highestResponseRatioNext(vector<Process>& processes) {
+    SCOPED_TIMER("hrrn");
+    int currentTime = 0;
+    int completedProcesses = 0;
+    int n = processes.size();
+
+    for (auto& process : processes) {
+        process.isCompleted = false;
+    }
+    ProcessColumns cols = makeColumns(processes);
+
+    while (completedProcesses < n) {
+        // Find the process with the highest response ratio that has arrived and is not completed
+        int idx = activeKernels.maxResponseRatio(cols.burst.data(), cols.arrival.data(), cols.done.data(), n, currentTime);
+        COUNT(scans, 1);
+        COUNT(scanLength, n);
+
+        if (idx != -1) {
+            COUNT(dispatches, 1);
+            processes[idx].firstStartTime = currentTime;
+            processes[idx].responseTime = currentTime - processes[idx].arrivalTime;
+            recordSlice(processes[idx], currentTime, currentTime + processes[idx].burstTime);
+            currentTime += processes[idx].burstTime;
+            processes[idx].completionTime = currentTime;
+            processes[idx].turnAroundTime = processes[idx].completionTime - processes[idx].arrivalTime;
+            processes[idx].waitingTime = processes[idx].turnAroundTime - processes[idx].burstTime;
+            processes[idx].normTurn = (double)processes[idx].turnAroundTime / processes[idx].burstTime;
+            processes[idx].isCompleted = true;
+            cols.done[idx] = -1;
+            completedProcesses++;
+        } else {
+            currentTime++;
+            COUNT(idleTicks, 1);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+
+// Function to perform Longest Remaining Time First(LRTF) scheduling 
+/* 
+Function to find the process with the (largest remaining time) among all available processes at the current time
+*/
+int findLargestRemainingTime(const ProcessColumns& cols, int currentTime) {
+    return activeKernels.maxKey(cols.remaining.data(), cols.arrival.data(), cols.done.data(), cols.arrival.size(), currentTime);
+}
+
+void longestRemainingTimeFirst(vector<Process>& processes) {
+    SCOPED_TIMER("lrtf");
+    sortByArrival(processes);
+
+    int currentTime = 0;
+    int totalProcesses = processes.size();
+    int completedProcesses = 0;
+    int prefinalTotal = 0;
+
+    // Initialize remaining times and calculate the total burst time (prefinalTotal)
+    for (auto& process : processes) {
+        process.remainingTime = process.burstTime;
+        process.burstTimeBackup = process.burstTime;
+        process.isCompleted = false;
+        process.firstStartTime = -1;
+        process.preemptions = 0;
+        prefinalTotal += process.burstTime;
+    }
+    ProcessColumns cols = makeColumns(processes);
+    int lastIdx = -1; // process that ran in the previous tick
+
+    while (completedProcesses < totalProcesses) {
+        int index = findLargestRemainingTime(cols, currentTime);
+        COUNT(scans, 1);
+        COUNT(scanLength, totalProcesses);
+
+        if (index != -1) {
+            if (index != lastIdx) {
+                COUNT(dispatches, 1);
+                if (lastIdx != -1 && !processes[lastIdx].isCompleted) {
+                    processes[lastIdx].preemptions++;
+                    COUNT(preemptions, 1);
+                }
+                lastIdx = index;
+            }
+            markDispatch(processes[index], currentTime);
+            recordSlice(processes[index], currentTime, currentTime + 1);
             processes[index].remainingTime -= 1;
+            cols.remaining[index] -= 1;
+            currentTime++;
+
+            if (processes[index].remainingTime == 0) {
+                processes[index].completionTime = currentTime;
+                processes[index].turnAroundTime = processes[index].completionTime - processes[index].arrivalTime;
+                processes[index].waitingTime = processes[index].turnAroundTime - processes[index].burstTimeBackup;
+                processes[index].normTurn = (double)processes[index].turnAroundTime / processes[index].burstTimeBackup;
+                processes[index].isCompleted = true;
+                cols.done[index] = -1;
+                completedProcesses++;
+                
+            }
+        } else {
             currentTime++;
+            COUNT(idleTicks, 1);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////
+
+// Function to return the nearest-rank percentile (q in (0,1]) of the values
+int percentile(vector<int> values, double q) {
+    if (values.empty()) return 0;
+    int rank = (int)ceil(q * values.size()) - 1;
+    rank = max(0, min(rank, (int)values.size() - 1));
+    nth_element(values.begin(), values.begin() + rank, values.end());
+    return values[rank];
+}
+
+// Function to print the statistics
+void printStats(const vector<Process>& processes) {
+    cout << "P_ID     |";
+    for (const auto& process : processes) {
+        cout << " " << process.name << " |";
+    }
+    cout << "\nAT       |";
+    for (const auto& process : processes) {
+        cout << "" << setw(3) << process.arrivalTime << " |";
+    }
+    cout << "\nBT       |";
+    for (const auto& process : processes) {
+        cout <<""<< setw(3) << process.burstTime << " |";
+    }
+
+    cout << "\nCT       |";
+    for (const auto& process : processes) {
+        cout << "" << setw(3) << process.completionTime << " |";
+    }
+
+    cout << "\nTAT      |";
+    double totalTurnAround = 0;
+    for (const auto& process : processes) {
+        cout << "" << setw(3) << process.turnAroundTime << " |";
+        totalTurnAround += process.turnAroundTime;
+    }
+    cout << "" << fixed << setprecision(2) << totalTurnAround / processes.size() << " |";
+
+    cout << "\nWT       |";
+    vector<int> waits, responses;
+    for (const auto& process : processes) {
+        cout << "" << setw(3) << process.waitingTime << " |";
+        waits.push_back(process.waitingTime);
+    }
+
+    cout << "\nRT       |";
+    double totalResponse = 0;
+    for (const auto& process : processes) {
+        cout << "" << setw(3) << process.responseTime << " |";
+        totalResponse += process.responseTime;
+        responses.push_back(process.responseTime);
+    }
+    cout << "" << fixed << setprecision(2) << totalResponse / processes.size() << " |";
+
+    cout << "\nNT       |";
+    double totalNormTurn = 0;
+    for (const auto& process : processes) {
+        cout << "" << setw(4) << fixed << setprecision(2) << process.normTurn << " |";
+        totalNormTurn += process.normTurn;
+    }
+    cout << "" << fixed << setprecision(2) << totalNormTurn / processes.size() << " |";
+
+    cout << "\nPRE      |";
+    for (const auto& process : processes) {
+        cout << "" << setw(3) << process.preemptions << " |";
+    }
+    cout << "\n";
+
+    cout << "WT p50/p95/p99: " << percentile(waits, 0.50) << " / " << percentile(waits, 0.95) << " / " << percentile(waits, 0.99) << "\n";
+    cout << "RT p50/p95/p99: " << percentile(responses, 0.50) << " / " << percentile(responses, 0.95) << " / " << percentile(responses, 0.99) << "\n";
+    
+}
+
+
+// Deadline metrics of one scheduled workload (only processes with a deadline count)
+struct DeadlineStats {
+    int withDeadline = 0;
+    int misses = 0;
+    double meanLateness = 0;
+    int p95Lateness = 0;
+    int maxLateness = 0;
+    double meanTardiness = 0;
+    double meanWaiting = 0;
+};
+
+// Function to compute miss count, lateness (CT - deadline) and tardiness (max(0, lateness))
+DeadlineStats deadlineStats(const vector<Process>& processes) {
+    DeadlineStats stats;
+    vector<int> lateness;
+    double totalWaiting = 0;
+    for (const auto& process : processes) {
+        totalWaiting += process.waitingTime;
+        if (process.deadline <= 0) continue;
+        int late = process.completionTime - process.deadline;
+        lateness.push_back(late);
+        stats.meanLateness += late;
+        stats.meanTardiness += max(0, late);
+        if (late > 0) stats.misses++;
+    }
+    stats.meanWaiting = totalWaiting / processes.size();
+    stats.withDeadline = lateness.size();
+    if (stats.withDeadline > 0) {
+        stats.meanLateness /= stats.withDeadline;
+        stats.meanTardiness /= stats.withDeadline;
+        stats.maxLateness = *max_element(lateness.begin(), lateness.end());
+        stats.p95Lateness = percentile(lateness, 0.95);
+    }
+    return stats;
+}
+
+// Function to run EDF, EDF[p], Highest Priority and SRTF on copies of the workload and compare deadline metrics
+void compareDeadlineSchedulers(const vector<Process>& processes) {
+    struct Candidate {
+        const char* name;
+        void (*scheduler)(vector<Process>&);
+    };
+    const Candidate candidates[] = {
+        {"EDF[non-p]", earliestDeadlineFirst},
+        {"EDF[p]", [](vector<Process>& copy) { preemptiveEarliestDeadlineFirst(copy); }},
+        {"HP[non-p]", highestPriority},
+        {"SRTF", [](vector<Process>& copy) { shortestRemainingTimeFirst(copy); }},
+    };
+
+    cout << "Algorithm  | Deadlines | Misses | Mean lateness | p95 lateness | Max lateness | Mean tardiness | Mean WT\n";
+    for (const auto& candidate : candidates) {
+        vector<Process> copy = processes;
+        candidate.scheduler(copy);
+        DeadlineStats stats = deadlineStats(copy);
+        cout << left << setw(10) << candidate.name << right << " | " << setw(9) << stats.withDeadline << " | " << setw(6) << stats.misses
+             << " | " << fixed << setprecision(2) << setw(13) << stats.meanLateness << " | " << setw(12) << stats.p95Lateness
+             << " | " << setw(12) << stats.maxLateness << " | " << setw(14) << stats.meanTardiness << " | " << setw(7) << stats.meanWaiting << "\n";
+    }
+}
+
+// Function to print the timeline
+void printTimeline(const vector<Process>& processes, int last_instant) {
+    for (int i = 0; i <= last_instant; i++) {
+        cout << i % 10 << " ";
+    }
+    cout << "\n------------------------------------------------\n";
+    for (const auto& process : processes) {
+        cout << process.name << "     |";
+        for (int j = 0; j < last_instant; j++) {
+            if (j >= process.arrivalTime && j < process.completionTime) {
+                cout << "*|";
+            } else {
+                cout << " |";
+            }
+        }
+        cout << "\n";
+    }
+    cout << "------------------------------------------------\n";
+}
+
+/*
+Execution trace in Chrome Trace Event JSON, for chrome://tracing or ui.perfetto.dev.
+Each slice becomes a complete ("X") event on one "CPU" track, with one time unit
+shown as 1 us. Slices are streamed to the file as they arrive; only the slice being
+extended is held, and adjacent slices of the same process (e.g. the tick-by-tick runs
+of HP[p] and LRTF, or SRTF runs split at arrivals) are merged into one event.
+*/
+struct ChromeTraceWriter : SliceSink {
+    ofstream out;
+    vector<char> buffer;
+    const Process* pending = nullptr;
+    int pendingStart = 0;
+    int pendingEnd = 0;
+    long long slices = 0;
+    long long events = 0;
+
+    bool open(const string& path) {
+        buffer.resize(1 << 20);
+        out.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+        out.open(path, ios::binary | ios::trunc);
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+            << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"scheduler\"}},\n"
+            << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"CPU\"}}";
+        return (bool)out;
+    }
+
+    void slice(const Process& process, int start, int end) override {
+        slices++;
+        if (pending == &process && start == pendingEnd) {
+            pendingEnd = end;
+            return;
+        }
+        flush();
+        pending = &process;
+        pendingStart = start;
+        pendingEnd = end;
+    }
+
+    // Function to write the pending slice as one event
+    void flush() {
+        if (!pending) return;
+        out << ",\n{\"name\":\"";
+        for (char c : pending->name) {
+            if (c == '"' || c == '\\') out << '\\' << c;
+            else if ((unsigned char)c < 0x20) out << ' ';
+            else out << c;
+        }
+        out << "\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":" << pendingStart
+            << ",\"dur\":" << pendingEnd - pendingStart << "}";
+        events++;
+        pending = nullptr;
+    }
+
+    bool close() {
+        flush();
+        out << "\n]}\n";
+        out.close();
+        return !out.fail();
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////
+
+// Text workloads (the format of input.txt)
+/*
+A workload is a block of initializer lines such as
+    {"P1", 3, 4, 0, 0, 0, 0, 0, 0},    // comment
+with fields in Process order (name, AT, BT, CT, WT, TAT, NT, RT, priority, P_No,
+burstTimeBackup, jobClass, deadline, {CPU, I/O, ...}); missing trailing fields are 0.
+A line that starts with a number followed by ']' (e.g. "2] RR") starts a new workload.
+*/
+struct Workload {
+    string name;
+    vector<Process> processes;
+};
+
+// Function to parse one initializer line in [begin, end) into a Process; false if the line holds none
+bool parseProcessLine(const char* begin, const char* end, Process& process) {
+    const char* open = find(begin, end, '{');
+    const char* firstQuote = find(open, end, '"');
+    const char* secondQuote = firstQuote == end ? end : find(firstQuote + 1, end, '"');
+    if (open == end || secondQuote == end) return false;
+
+    process.name.assign(firstQuote + 1, secondQuote);
+    int* intFields[] = {&process.arrivalTime, &process.burstTime, &process.completionTime, &process.waitingTime,
+                        &process.turnAroundTime, nullptr, &process.remainingTime, &process.priority,
+                        &process.processno, &process.burstTimeBackup, &process.jobClass, &process.deadline};
+    for (int* field : intFields) {
+        if (field) *field = 0;
+    }
+    process.normTurn = 0;
+    process.bursts.clear();
+
+    // Numbers are read with strtod/strtol straight from the buffer, so a line costs no allocation
+    int field = 0;
+    const char* pos = secondQuote + 1;
+    while (pos < end && *pos != '}' && *pos != '{') {
+        if (isdigit((unsigned char)*pos) || *pos == '-' || *pos == '.') {
+            char* next;
+            if (field < 12 && !intFields[field]) process.normTurn = strtod(pos, &next);
+            else if (field < 12) *intFields[field] = (int)strtol(pos, &next, 10);
+            else strtod(pos, &next);
+            if (*next == '.') strtod(next, &next); // fractional part of a value read as int
+            if (next == pos) next++;
+            field++;
+            pos = next;
+        } else {
+            pos++;
+        }
+    }
+    if (pos < end && *pos == '{') {
+        for (pos++; pos < end && *pos != '}';) {
+            if (isdigit((unsigned char)*pos) || *pos == '-') {
+                char* next;
+                process.bursts.push_back((int)strtol(pos, &next, 10));
+                pos = next;
+            } else {
+                pos++;
+            }
+        }
+    }
+    return true;
+}
+
+// Function to check whether [begin, end) is a workload header such as "2] RR"; stores the name after ']'
+bool parseWorkloadHeader(const char* begin, const char* end, string& name) {
+    while (begin < end && (*begin == ' ' || *begin == '\t')) begin++;
+    if (begin == end || !isdigit((unsigned char)*begin)) return false;
+    const char* bracket = find(begin, end, ']');
+    if (bracket == end || find(begin, end, '{') != end) return false;
+    const char* nameStart = bracket + 1;
+    while (nameStart < end && (*nameStart == ' ' || *nameStart == '\t')) nameStart++;
+    const char* nameEnd = end;
+    while (nameEnd > nameStart && isspace((unsigned char)nameEnd[-1])) nameEnd--;
+    name.assign(nameStart, nameEnd);
+    return true;
+}
+
+// Function to read every workload in a text file (lines before the first header form an unnamed workload)
+vector<Workload> readWorkloads(istream& in) {
+    vector<Workload> workloads;
+    string line, name;
+    Process process;
+    while (getline(in, line)) {
+        const char* begin = line.data();
+        const char* end = begin + line.size();
+        if (parseWorkloadHeader(begin, end, name)) {
+            workloads.push_back({name, {}});
+        } else if (parseProcessLine(begin, end, process)) {
+            if (workloads.empty()) workloads.push_back({"", {}});
+            workloads.back().processes.push_back(process);
+        }
+    }
+    return workloads;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////
+
+// Columnar binary traces
+/*
+Layout (little endian, every section 8-byte aligned):
+  TraceHeader
+  int32 arrival[count], int32 burst[count], int32 priority[count], int32 nameId[count]
+  uint32 nameOffset[nameCount + 1], char nameBytes[]   (name dictionary, distinct names only)
+  int32 blockMin[blockCount], int32 blockMax[blockCount] (arrival range of each block of blockSize rows)
+Rows are stored sorted by arrival time, so the block index can find a time window
+without touching the columns. MappedTrace maps the file read-only and hands out
+pointers into it; nothing is parsed or copied.
+*/
+struct TraceHeader {
+    uint32_t magic;
+    uint32_t version;
+    int64_t count;
+    int64_t nameCount;
+    int64_t blockSize;
+    int64_t blockCount;
+    int64_t arrivalOffset;
+    int64_t burstOffset;
+    int64_t priorityOffset;
+    int64_t nameIdOffset;
+    int64_t nameOffsetsOffset;
+    int64_t nameBytesOffset;
+    int64_t blockMinOffset;
+    int64_t blockMaxOffset;
+    int64_t fileSize;
+};
+
+const uint32_t TRACE_MAGIC = 0x54484353; // "SCHT"
+const uint32_t TRACE_VERSION = 1;
+const int TRACE_BLOCK_SIZE = 4096;
+
+// Function to write processes as a columnar trace (rows sorted by arrival)
+bool writeTrace(vector<Process> processes, const string& path) {
+    sortByArrival(processes);
+    int64_t n = processes.size();
+
+    // Name dictionary: each distinct name is stored once
+    unordered_map<string, int> nameIds;
+    vector<int32_t> nameId(n);
+    vector<uint32_t> nameOffsets(1, 0);
+    string nameBytes;
+    for (int64_t i = 0; i < n; ++i) {
+        auto inserted = nameIds.emplace(processes[i].name, (int)nameIds.size());
+        if (inserted.second) {
+            nameBytes += processes[i].name;
+            nameOffsets.push_back(nameBytes.size());
+        }
+        nameId[i] = inserted.first->second;
+    }
+
+    TraceHeader header = {};
+    header.magic = TRACE_MAGIC;
+    header.version = TRACE_VERSION;
+    header.count = n;
+    header.nameCount = nameIds.size();
+    header.blockSize = TRACE_BLOCK_SIZE;
+    header.blockCount = (n + TRACE_BLOCK_SIZE - 1) / TRACE_BLOCK_SIZE;
+    int64_t offset = 0;
+    auto place = [&offset](int64_t bytes) {
+        int64_t at = (offset + 7) & ~int64_t(7);
+        offset = at + bytes;
+        return at;
+    };
+    place(sizeof(TraceHeader));
+    header.arrivalOffset = place(n * 4);
+    header.burstOffset = place(n * 4);
+    header.priorityOffset = place(n * 4);
+    header.nameIdOffset = place(n * 4);
+    header.nameOffsetsOffset = place(nameOffsets.size() * 4);
+    header.nameBytesOffset = place(nameBytes.size());
+    header.blockMinOffset = place(header.blockCount * 4);
+    header.blockMaxOffset = place(header.blockCount * 4);
+    header.fileSize = offset;
+
+    vector<int32_t> column(n);
+    vector<int32_t> blockMin(header.blockCount, INT_MAX), blockMax(header.blockCount, INT_MIN);
+    ofstream out(path, ios::binary | ios::trunc);
+    if (!out) return false;
+    auto writeAt = [&out](int64_t at, const void* data, int64_t bytes) {
+        out.seekp(at);
+        out.write((const char*)data, bytes);
+    };
+    writeAt(0, &header, sizeof(header));
+    for (int64_t i = 0; i < n; ++i) {
+        column[i] = processes[i].arrivalTime;
+        blockMin[i / TRACE_BLOCK_SIZE] = min(blockMin[i / TRACE_BLOCK_SIZE], column[i]);
+        blockMax[i / TRACE_BLOCK_SIZE] = max(blockMax[i / TRACE_BLOCK_SIZE], column[i]);
+    }
+    writeAt(header.arrivalOffset, column.data(), n * 4);
+    for (int64_t i = 0; i < n; ++i) column[i] = processes[i].burstTime;
+    writeAt(header.burstOffset, column.data(), n * 4);
+    for (int64_t i = 0; i < n; ++i) column[i] = processes[i].priority;
+    writeAt(header.priorityOffset, column.data(), n * 4);
+    writeAt(header.nameIdOffset, nameId.data(), n * 4);
+    writeAt(header.nameOffsetsOffset, nameOffsets.data(), nameOffsets.size() * 4);
+    writeAt(header.nameBytesOffset, nameBytes.data(), nameBytes.size());
+    writeAt(header.blockMinOffset, blockMin.data(), header.blockCount * 4);
+    writeAt(header.blockMaxOffset, blockMax.data(), header.blockCount * 4);
+    // Pad to the full size so the last section is always inside the mapping
+    char zero = 0;
+    writeAt(header.fileSize - 1, &zero, 1);
+    return (bool)out;
+}
+
+// Read-only memory mapping of a columnar trace
+struct MappedTrace {
+    const char* base = nullptr;
+    size_t size = 0;
+    const TraceHeader* header = nullptr;
+    const int32_t* arrival = nullptr;
+    const int32_t* burst = nullptr;
+    const int32_t* priority = nullptr;
+    const int32_t* nameId = nullptr;
+    const uint32_t* nameOffsets = nullptr;
+    const char* nameBytes = nullptr;
+    const int32_t* blockMin = nullptr;
+    const int32_t* blockMax = nullptr;
+    int count = 0;
+
+    MappedTrace() = default;
+    MappedTrace(const MappedTrace&) = delete;
+    MappedTrace& operator=(const MappedTrace&) = delete;
+    ~MappedTrace() {
+        if (base) munmap((void*)base, size);
+    }
 
-            if (processes[index].remainingTime == 0) {
-                processes[index].completionTime = currentTime;
-                processes[index].turnAroundTime = processes[index].completionTime - processes[index].arrivalTime;
-                processes[index].waitingTime = processes[index].turnAroundTime - processes[index].burstTimeBackup;
-                processes[index].normTurn = (double)processes[index].turnAroundTime / processes[index].burstTimeBackup;
-                processes[index].isCompleted = true;
-                completedProcesses++;
-                
+    bool open(const string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(TraceHeader)) {
+            close(fd);
+            return false;
+        }
+        void* mapped = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapped == MAP_FAILED) return false;
+        base = (const char*)mapped;
+        size = st.st_size;
+        header = (const TraceHeader*)base;
+        if (header->magic != TRACE_MAGIC || header->version != TRACE_VERSION || header->fileSize > (int64_t)size
+            || header->count < 0 || header->count > INT_MAX || header->nameCount < 0
+            || header->nameCount > header->count || header->blockSize <= 0
+            || header->blockCount != (header->count + header->blockSize - 1) / header->blockSize) {
+            return false;
+        }
+        // Every section must lie inside the file, after the header and 4-byte aligned
+        auto inFile = [this](int64_t offset, int64_t bytes) {
+            return offset >= (int64_t)sizeof(TraceHeader) && offset % 4 == 0 && offset <= header->fileSize - bytes;
+        };
+        int64_t columnBytes = header->count * 4, blockBytes = header->blockCount * 4;
+        if (!inFile(header->arrivalOffset, columnBytes) || !inFile(header->burstOffset, columnBytes)
+            || !inFile(header->priorityOffset, columnBytes) || !inFile(header->nameIdOffset, columnBytes)
+            || !inFile(header->nameOffsetsOffset, (header->nameCount + 1) * 4)
+            || !inFile(header->blockMinOffset, blockBytes) || !inFile(header->blockMaxOffset, blockBytes)) {
+            return false;
+        }
+        // The name dictionary must be ascending offsets into a name-bytes section inside the file
+        nameOffsets = (const uint32_t*)(base + header->nameOffsetsOffset);
+        if (nameOffsets[0] != 0 || header->nameBytesOffset < (int64_t)sizeof(TraceHeader)
+            || header->nameBytesOffset > header->fileSize - (int64_t)nameOffsets[header->nameCount]) {
+            return false;
+        }
+        for (int64_t id = 0; id < header->nameCount; ++id) {
+            if (nameOffsets[id] > nameOffsets[id + 1]) return false;
+        }
+        count = header->count;
+        arrival = (const int32_t*)(base + header->arrivalOffset);
+        burst = (const int32_t*)(base + header->burstOffset);
+        priority = (const int32_t*)(base + header->priorityOffset);
+        nameId = (const int32_t*)(base + header->nameIdOffset);
+        nameBytes = base + header->nameBytesOffset;
+        blockMin = (const int32_t*)(base + header->blockMinOffset);
+        blockMax = (const int32_t*)(base + header->blockMaxOffset);
+        madvise(mapped, size, MADV_SEQUENTIAL);
+        return true;
+    }
+
+    // Name ids are checked here rather than in open(), so a run over a window never scans the whole column
+    string name(int i) const {
+        int id = nameId[i];
+        if (id < 0 || id >= header->nameCount) return "?";
+        return string(nameBytes + nameOffsets[id], nameOffsets[id + 1] - nameOffsets[id]);
+    }
+
+    // First row arriving at or after `time`: binary search over the block index, then within one block
+    int firstArrivalAtOrAfter(int time) const {
+        int lo = 0, hi = header->blockCount;
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+            if (blockMax[mid] < time) lo = mid + 1;
+            else hi = mid;
+        }
+        int row = min<int64_t>(lo * header->blockSize, count);
+        while (row < count && arrival[row] < time) row++;
+        return row;
+    }
+};
+
+/*
+Function to run a non-preemptive scheduler straight off the mapped columns for the rows
+arriving in [fromTime, toTime): 1 = FCFS, 3 = SPN, 5 = Highest Priority, 7 = HRRN. HP and
+HRRN use the selection kernels on the mapped arrays. Only the completion times are
+allocated; the averages are printed.
+*/
+bool runMappedTrace(const MappedTrace& trace, int choice, int fromTime, int toTime) {
+    int first = trace.firstArrivalAtOrAfter(fromTime);
+    int last = trace.firstArrivalAtOrAfter(toTime);
+    int n = last - first;
+    if (n <= 0) {
+        cout << "No processes arrive in that window.\n";
+        return true;
+    }
+    const int32_t* arrival = trace.arrival + first;
+    const int32_t* burst = trace.burst + first;
+    const int32_t* priority = trace.priority + first;
+    vector<int> completion(n);
+    vector<int> start(n);
+
+    if (choice == 1) {
+        int time = 0;
+        for (int i = 0; i < n; ++i) {
+            time = max(time, arrival[i]);
+            start[i] = time;
+            time += burst[i];
+            completion[i] = time;
+        }
+    } else if (choice == 3) {
+        priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> pq; // (burst, row)
+        int idx = 0, time = 0;
+        while (idx < n || !pq.empty()) {
+            if (pq.empty()) time = max(time, arrival[idx]);
+            while (idx < n && arrival[idx] <= time) {
+                pq.push(make_pair(burst[idx], idx));
+                idx++;
             }
-            cout << endl;
-        } else {
-            currentTime++;
+            int i = pq.top().second;
+            pq.pop();
+            start[i] = time;
+            time += burst[i];
+            completion[i] = time;
         }
+    } else if (choice == 5 || choice == 7) {
+        vector<int> done(n, 0);
+        int time = 0;
+        for (int completed = 0; completed < n;) {
+            int i = choice == 5 ? activeKernels.maxKey(priority, arrival, done.data(), n, time)
+                                : activeKernels.maxResponseRatio(burst, arrival, done.data(), n, time);
+            if (i == -1) {
+                time++;
+                continue;
+            }
+            start[i] = time;
+            time += burst[i];
+            completion[i] = time;
+            done[i] = -1;
+            completed++;
+        }
+    } else {
+        return false;
+    }
+
+    double totalTurnAround = 0, totalWaiting = 0, totalResponse = 0;
+    for (int i = 0; i < n; ++i) {
+        totalTurnAround += completion[i] - arrival[i];
+        totalWaiting += completion[i] - arrival[i] - burst[i];
+        totalResponse += start[i] - arrival[i];
     }
+    cout << "Processes: " << n << " (rows " << first << ".." << last - 1 << ", first " << trace.name(first) << ")\n";
+    cout << "Avg TAT: " << fixed << setprecision(2) << totalTurnAround / n << "\n";
+    cout << "Avg WT : " << totalWaiting / n << "\n";
+    cout << "Avg RT : " << totalResponse / n << "\n";
+    return true;
 }
 
-///////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////
 
-// Function to print the statistics
-void printStats(const vector<Process>& processes) {
-    cout << "P_ID     |";
-    for (const auto& process : processes) {
-        cout << " " << process.name << " |";
-    }
-    cout << "\nAT       |";
-    for (const auto& process : processes) {
-        cout << "" << setw(3) << process.arrivalTime << " |";
+// Function to build a random workload of n processes (sorted by arrival time)
+vector<Process> generateWorkload(int n, unsigned seed) {
+    mt19937 rng(seed);
+    uniform_int_distribution<int> burstDist(1, 20);
+    uniform_int_distribution<int> priorityDist(0, 9);
+    uniform_int_distribution<int> arrivalDist(0, max(1, n * 5)); // ~half the total work, keeps a ready backlog
+    vector<Process> processes(n);
+    for (int i = 0; i < n; ++i) {
+        processes[i].name = "P" + to_string(i + 1);
+        processes[i].arrivalTime = arrivalDist(rng);
+        processes[i].burstTime = burstDist(rng);
+        processes[i].priority = priorityDist(rng);
+        processes[i].processno = i + 1;
     }
-    cout << "\nBT       |";
-    for (const auto& process : processes) {
-        cout <<""<< setw(3) << process.burstTime << " |";
+    sortByArrival(processes);
+    return processes;
+}
+
+// Heap-based Highest Priority[non-p], used as the reference point for the scan crossover
+void highestPriorityHeap(vector<Process>& processes) {
+    priority_queue<pair<int, int>> pq; // (priority, -index): highest priority, then lowest index
+    int n = processes.size();
+    int idx = 0;
+    int currentTime = 0;
+
+    while (idx < n || !pq.empty()) {
+        if (pq.empty() && currentTime < processes[idx].arrivalTime) {
+            currentTime = processes[idx].arrivalTime;
+        }
+        while (idx < n && processes[idx].arrivalTime <= currentTime) {
+            pq.push(make_pair(processes[idx].priority, -idx));
+            idx++;
+        }
+        int i = -pq.top().second;
+        pq.pop();
+        currentTime += processes[i].burstTime;
+        processes[i].completionTime = currentTime;
     }
+}
 
-    cout << "\nCT       |";
-    for (const auto& process : processes) {
-        cout << "" << setw(3) << process.completionTime << " |";
+// Function to time the scan kernels (scalar vs SIMD) against the heap engine for growing n
+void benchmarkSelectionKernels() {
+    SelectionKernels detected = detectKernels();
+    cout << "SIMD kernels: " << detected.name << "\n";
+    cout << "      n | HP scalar ms |   HP " << setw(4) << detected.name << " ms | HP heap ms | HRRN scalar ms |   HRRN " << setw(4) << detected.name << " ms | match\n";
+
+    for (int n : {16, 64, 256, 1024, 4096, 16384}) {
+        vector<Process> base = generateWorkload(n, 42 + n);
+        int reps = max(1, 65536 / n);
+
+        auto timeRun = [&](void (*scheduler)(vector<Process>&), vector<Process>& out) {
+            auto start = chrono::steady_clock::now();
+            for (int r = 0; r < reps; ++r) {
+                out = base;
+                scheduler(out);
+            }
+            return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / reps;
+        };
+
+        vector<Process> hpScalar, hpSimd, hpHeap, hrrnScalar, hrrnSimd;
+        activeKernels = scalarKernels;
+        double tHpScalar = timeRun(highestPriority, hpScalar);
+        double tHrrnScalar = timeRun(highestResponseRatioNext, hrrnScalar);
+        activeKernels = detected;
+        double tHpSimd = timeRun(highestPriority, hpSimd);
+        double tHrrnSimd = timeRun(highestResponseRatioNext, hrrnSimd);
+        double tHpHeap = timeRun(highestPriorityHeap, hpHeap);
+
+        bool match = true;
+        for (int i = 0; i < n; ++i) {
+            match = match && hpScalar[i].completionTime == hpSimd[i].completionTime
+                          && hpScalar[i].completionTime == hpHeap[i].completionTime
+                          && hrrnScalar[i].completionTime == hrrnSimd[i].completionTime;
+        }
+        cout << setw(7) << n << " | " << fixed << setprecision(4)
+             << setw(12) << tHpScalar << " | " << setw(12) << tHpSimd << " | " << setw(10) << tHpHeap << " | "
+             << setw(14) << tHrrnScalar << " | " << setw(14) << tHrrnSimd << " | " << (match ? "yes" : "NO") << "\n";
     }
+}
 
-    cout << "\nTAT      |";
-    double totalTurnAround = 0;
-    for (const auto& process : processes) {
-        cout << "" << setw(3) << process.turnAroundTime << " |";
-        totalTurnAround += process.turnAroundTime;
+// Function to compare the timing wheel with a binary heap on a hold workload of `events` expirations
+/*
+Hold model: keep `pending` timers outstanding; every expired timer schedules a new one a
+random delay later, as arrivals, I/O wakeups and deadline timers do in a long simulation.
+*/
+void benchmarkTimerWheel(int events, int pending) {
+    const int maxDelay = 10000;
+    cout << events << " events, " << pending << " pending timers, delays 1.." << maxDelay << "\n";
+
+    // Binary heap
+    {
+        mt19937 rng(7);
+        uniform_int_distribution<int> delay(1, maxDelay);
+        priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> heap;
+        for (int i = 0; i < pending; ++i) heap.push(make_pair(delay(rng), i));
+        auto start = chrono::steady_clock::now();
+        long long checksum = 0;
+        for (int processed = 0; processed < events; ++processed) {
+            pair<int, int> top = heap.top();
+            heap.pop();
+            checksum += top.first;
+            heap.push(make_pair(top.first + delay(rng), top.second));
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << "binary heap   : " << fixed << setprecision(3) << seconds << " s (" << setprecision(1)
+             << seconds * 1e9 / events << " ns/event), checksum " << checksum << "\n";
     }
-    cout << "" << fixed << setprecision(2) << totalTurnAround / processes.size() << " |";
 
-    cout << "\nWT       |";
-    for (const auto& process : processes) {
-        cout << "" << setw(3) << process.waitingTime << " |";
+    // Hierarchical timing wheel
+    {
+        mt19937 rng(7);
+        uniform_int_distribution<int> delay(1, maxDelay);
+        unique_ptr<TimerWheel> wheel(new TimerWheel());
+        for (int i = 0; i < pending; ++i) wheel->schedule(delay(rng), i);
+        vector<pair<int, int>> due;
+        auto start = chrono::steady_clock::now();
+        long long checksum = 0;
+        int processed = 0;
+        while (processed < events) {
+            due.clear();
+            wheel->advance(wheel->nextExpiry(), due);
+            for (const auto& event : due) {
+                if (processed == events) break;
+                checksum += event.first;
+                wheel->schedule(event.first + delay(rng), event.second);
+                processed++;
+            }
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << "timing wheel  : " << fixed << setprecision(3) << seconds << " s (" << setprecision(1)
+             << seconds * 1e9 / events << " ns/event), checksum " << checksum << "\n";
     }
+}
 
-    cout << "\nNT       |";
-    double totalNormTurn = 0;
-    for (const auto& process : processes) {
-        cout << "" << setw(4) << fixed << setprecision(2) << process.normTurn << " |";
-        totalNormTurn += process.normTurn;
+///////////////////////////////////////////////////////////////////////////////////////////
+
+// Function to run one of the menu algorithms 1-8 on the processes; false for any other choice
+bool runScheduler(int choice, vector<Process>& processes, int slice) {
+    if (choice == 1) {
+        firstComeFirstServe(processes);
+    } else if (choice == 2) {
+        roundRobin(processes, slice);
+    } else if (choice == 3) {
+        shortestProcessNext(processes);
+    } else if (choice == 4) {
+        shortestRemainingTimeFirst(processes);
+    } else if (choice == 5) {
+        highestPriority(processes);
+    } else if (choice == 6) {
+        preemptiveHighestPriority(processes);
+    } else if (choice == 7) {
+        highestResponseRatioNext(processes);
+    } else if (choice == 8) {
+        longestRemainingTimeFirst(processes);
+    } else {
+        return false;
     }
-    cout << "" << fixed << setprecision(2) << totalNormTurn / processes.size() << " |\n";
-    
+    return true;
 }
 
+// Perturbations applied to every Monte Carlo variant
+struct WhatIf {
+    double loadPercent;       // every burst scaled by (1 + loadPercent/100)
+    double burstErrorPercent; // each burst additionally off by up to +-burstErrorPercent
+    int arrivalJitter;        // each arrival shifted by up to +-arrivalJitter time units
+};
 
-// Function to print the timeline
-void printTimeline(const vector<Process>& processes, int last_instant) {
-    for (int i = 0; i <= last_instant; i++) {
-        cout << i % 10 << " ";
+// Function to print mean and 95% confidence interval of a sample
+void printInterval(const string& label, const vector<double>& values) {
+    double mean = 0;
+    for (double v : values) mean += v;
+    mean /= values.size();
+    double variance = 0;
+    for (double v : values) variance += (v - mean) * (v - mean);
+    variance /= max<size_t>(1, values.size() - 1);
+    double halfWidth = 1.96 * sqrt(variance / values.size());
+    cout << label << fixed << setprecision(3) << mean << "  (95% CI " << mean - halfWidth << " .. " << mean + halfWidth << ")\n";
+}
+
+/*
+Function to replay `variants` perturbed copies of the base workload with the chosen
+algorithm and report mean and p99 waiting time with confidence intervals. Variant v
+draws from its own RNG stream seeded by (seed, v), so results do not depend on the
+thread count or on which worker ran it.
+*/
+void monteCarloWhatIf(const vector<Process>& base, int choice, int slice, int variants,
+                      const WhatIf& whatIf, unsigned seed, int threads) {
+    vector<double> meanWait(variants), p99Wait(variants);
+    // Per-worker buffers, reused for every variant that worker runs
+    vector<vector<Process>> workloads(threads);
+    vector<vector<int>> waits(threads);
+
+    auto start = chrono::steady_clock::now();
+    parallelFor(variants, threads, [&](int worker, int v) {
+        seed_seq streamSeed{seed, (unsigned)v};
+        mt19937_64 rng(streamSeed);
+        uniform_real_distribution<double> burstError(-whatIf.burstErrorPercent / 100.0, whatIf.burstErrorPercent / 100.0);
+        uniform_int_distribution<int> jitter(-whatIf.arrivalJitter, whatIf.arrivalJitter);
+
+        vector<Process>& processes = workloads[worker];
+        processes.assign(base.begin(), base.end());
+        for (auto& process : processes) {
+            double scale = (1.0 + whatIf.loadPercent / 100.0) * (1.0 + burstError(rng));
+            process.burstTime = max(1, (int)lround(process.burstTime * scale));
+            process.arrivalTime = max(0, process.arrivalTime + jitter(rng));
+        }
+        sortByArrival(processes);
+        runScheduler(choice, processes, slice);
+
+        vector<int>& w = waits[worker];
+        w.clear();
+        double total = 0;
+        for (const auto& process : processes) {
+            w.push_back(process.waitingTime);
+            total += process.waitingTime;
+        }
+        int rank = max(0, (int)ceil(0.99 * w.size()) - 1);
+        nth_element(w.begin(), w.begin() + rank, w.end());
+        meanWait[v] = total / processes.size();
+        p99Wait[v] = w[rank];
+    });
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << variants << " variants on " << threads << " thread(s) in " << fixed << setprecision(3) << seconds
+         << " s (" << setprecision(0) << variants / max(seconds, 1e-9) << " replays/s)\n";
+    printInterval("Mean WT: ", meanWait);
+    printInterval("p99 WT : ", p99Wait);
+}
+
+// One workload of a batch file: its process lines and where its result row ended up
+struct BatchEntry {
+    const char* begin;
+    const char* end;
+    string name;
+    int worker;
+    size_t outputOffset;
+    size_t outputLength;
+};
+
+// Function to quote a CSV field (RFC 4180) when it holds a comma, quote or line break
+string csvField(const string& field) {
+    if (field.find_first_of(",\"\r\n") == string::npos) return field;
+    string quoted = "\"";
+    for (char c : field) {
+        if (c == '"') quoted += '"';
+        quoted += c;
     }
-    cout << "\n------------------------------------------------\n";
-    for (const auto& process : processes) {
-        cout << process.name << "     |";
-        for (int j = 0; j < last_instant; j++) {
-            if (j >= process.arrivalTime && j < process.completionTime) {
-                cout << "*|";
+    return quoted + "\"";
+}
+
+/*
+Function to schedule every workload of a text file (format of input.txt, one numbered
+section per workload) with the chosen algorithm and write one CSV row per workload to
+outputPath. Workloads with CPU / I-O phases run the I/O simulation where the algorithm
+has one (FCFS, RR, SPN, SRTF, HP; io column "io"); HP[p], HRRN and LRTF run them on the
+folded CPU time instead (io column "cpu-only"). The file is read once into memory and split into sections; workers then
+parse, sort and schedule whole workloads in parallel, each reusing its own process
+vector and output buffer. Rows are written in file order at the end.
+*/
+bool runBatch(const string& inputPath, const string& outputPath, int choice, int slice, int threads) {
+    auto start = chrono::steady_clock::now();
+    ifstream in(inputPath, ios::binary);
+    if (!in) return false;
+    in.seekg(0, ios::end);
+    string text(in.tellg(), '\0');
+    in.seekg(0);
+    in.read(&text[0], text.size());
+
+    vector<BatchEntry> entries;
+    string name;
+    for (const char* line = text.data(), *textEnd = text.data() + text.size(); line < textEnd;) {
+        const char* lineEnd = (const char*)memchr(line, '\n', textEnd - line);
+        if (!lineEnd) lineEnd = textEnd;
+        if (parseWorkloadHeader(line, lineEnd, name)) {
+            entries.push_back({lineEnd, lineEnd, name, 0, 0, 0});
+        } else if (find(line, lineEnd, '{') != lineEnd) {
+            if (entries.empty()) entries.push_back({line, line, "", 0, 0, 0});
+            entries.back().end = lineEnd;
+        }
+        line = lineEnd + 1;
+    }
+
+    // Per-worker buffers, reused for every workload that worker runs
+    vector<vector<Process>> workloads(threads);
+    vector<Process> parsed(threads);
+    vector<string> outputs(threads);
+    parallelFor(entries.size(), threads, [&](int worker, int w) {
+        BatchEntry& entry = entries[w];
+        vector<Process>& processes = workloads[worker];
+        processes.clear();
+        for (const char* line = entry.begin; line < entry.end;) {
+            const char* lineEnd = find(line, entry.end, '\n');
+            if (parseProcessLine(line, lineEnd, parsed[worker])) processes.push_back(parsed[worker]);
+            line = lineEnd + 1;
+        }
+
+        double totalTurnAround = 0, totalWaiting = 0, totalResponse = 0;
+        int makespan = 0, maxWaiting = 0;
+        const char* io = "";
+        if (!processes.empty()) {
+            sortByArrival(processes);
+            bool phases = hasPhases(processes);
+            if (phases && choice == 4) {
+                shortestRemainingTimeFirst(processes, true);
+                io = "io";
+            } else if (phases && (choice == 1 || choice == 2 || choice == 3 || choice == 5)) {
+                ioBurstScheduler(processes, choice, slice);
+                io = "io";
             } else {
-                cout << " |";
+                if (phases) io = "cpu-only";
+                foldPhases(processes);
+                runScheduler(choice, processes, slice);
+            }
+            for (const auto& process : processes) {
+                totalTurnAround += process.turnAroundTime;
+                totalWaiting += process.waitingTime;
+                totalResponse += process.responseTime;
+                makespan = max(makespan, process.completionTime);
+                maxWaiting = max(maxWaiting, process.waitingTime);
             }
         }
-        cout << "\n";
+        double n = max<size_t>(1, processes.size());
+        char row[512];
+        int length = snprintf(row, sizeof(row), "%d,%s,%zu,%d,%.2f,%.2f,%.2f,%d,%s\n", w + 1, csvField(entry.name).c_str(),
+                              processes.size(), makespan, totalTurnAround / n, totalWaiting / n, totalResponse / n,
+                              maxWaiting, io);
+        length = min<int>(length, sizeof(row) - 1);
+        entry.worker = worker;
+        entry.outputOffset = outputs[worker].size();
+        entry.outputLength = length;
+        outputs[worker].append(row, length);
+    });
+
+    ofstream out(outputPath, ios::binary | ios::trunc);
+    if (!out) return false;
+    out << "workload,name,processes,makespan,avg_tat,avg_wt,avg_rt,max_wt,io\n";
+    for (const auto& entry : entries) {
+        out.write(outputs[entry.worker].data() + entry.outputOffset, entry.outputLength);
     }
-    cout << "------------------------------------------------\n";
+    out.close();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    cout << entries.size() << " workloads on " << threads << " thread(s) in " << fixed << setprecision(3) << seconds
+         << " s (" << setprecision(0) << entries.size() / max(seconds, 1e-9) << " workloads/s)\n";
+    return (bool)out;
+}
+
+// Incremental re-scheduling for non-preemptive policies
+/*
+A non-preemptive run only depends on the jobs admitted so far, so after editing one job
+(add, remove or change) everything the base run did before the edited job arrived still
+holds. The base run keeps a checkpoint (time, arrival cursor, dispatch count) every
+`interval` dispatches; an edit resumes from the last checkpoint whose cursor is before
+the edit and whose time is not after the edited job's arrival. The ready set is not
+stored: at a checkpoint it is exactly the admitted jobs the base run had not dispatched
+yet, and is rebuilt from the dispatch order on resume, so checkpoints cost O(1) memory
+however long the backlog. The run also stops early: once the arrival cursor is past
+the edit and the ready set is empty at a job where the base run's ready set was empty too, both runs
+start the same busy period from the same job and are identical from then on. Only the
+jobs in between are re-simulated; the totals are patched by their difference.
+Policies: 1 = FCFS, 3 = SPN, 5 = Highest Priority, 15 = EDF (smaller key runs first,
+ties by arrival order, as in the full schedulers).
+*/
+struct NonPreemptiveCheckpoint {
+    int currentTime;
+    int nextArrival;
+    int dispatched;    // jobs dispatched before the checkpoint
+    int oldestWaiting; // lowest index not dispatched yet; waiting jobs lie in [oldestWaiting, nextArrival)
+};
+
+struct IncrementalSchedule {
+    int policy = 1;
+    int interval = 4096;
+    vector<int> arrival, burst, key; // sorted by arrival
+    vector<int> start, completion;
+    vector<int> dispatchOrder; // position of job i in the dispatch sequence
+    vector<char> busyStart; // the ready set was empty with job i next to arrive
+    vector<NonPreemptiveCheckpoint> checkpoints;
+    long long totalTurnAround = 0, totalWaiting = 0, totalResponse = 0;
+    int makespan = 0;
+};
+
+// The base trace with one job added, removed or changed, without copying it
+struct JobEdit {
+    const IncrementalSchedule* base = nullptr;
+    int size = 0;
+    int removed = -1;  // base index of the removed or changed job
+    int inserted = -1; // index of the added or changed job in the edited trace
+    int insertedArrival = 0, insertedBurst = 0, insertedKey = 0;
+
+    int baseIndex(int k) const { // -1 for the inserted job
+        if (k == inserted) return -1;
+        if (inserted != -1 && k > inserted) k--;
+        if (removed != -1 && k >= removed) k++;
+        return k;
+    }
+    int arrival(int k) const { return k == inserted ? insertedArrival : base->arrival[baseIndex(k)]; }
+    int burst(int k) const { return k == inserted ? insertedBurst : base->burst[baseIndex(k)]; }
+    int key(int k) const { return k == inserted ? insertedKey : base->key[baseIndex(k)]; }
+};
+
+struct IncrementalResult {
+    long long totalTurnAround = 0, totalWaiting = 0, totalResponse = 0;
+    int makespan = 0;
+    int count = 0;
+    int resumedAt = 0;     // time of the checkpoint the run resumed from
+    int resimulated = 0;   // jobs dispatched by the re-simulation
+    int convergedAt = -1;  // edited-trace index of the first shared busy period, -1 = ran to the end
+    vector<tuple<int, int, int>> changed; // (edited-trace index, start, completion) of re-simulated jobs
+};
+
+int policyKey(int policy, int burst, int priority, int deadline) {
+    if (policy == 3) return burst;
+    if (policy == 5) return -priority;
+    if (policy == 15) return deadline > 0 ? deadline : INT_MAX;
+    return 0; // FCFS: arrival order alone
+}
+
+// Function to run the base schedule, recording results, busy-period starts and checkpoints
+void buildIncrementalSchedule(IncrementalSchedule& s, const vector<Process>& processes, int policy, int interval) {
+    int n = processes.size();
+    s.policy = policy;
+    s.interval = max(1, interval);
+    s.arrival.resize(n);
+    s.burst.resize(n);
+    s.key.resize(n);
+    for (int i = 0; i < n; ++i) {
+        s.arrival[i] = processes[i].arrivalTime;
+        s.burst[i] = processes[i].burstTime;
+        s.key[i] = policyKey(policy, processes[i].burstTime, processes[i].priority, processes[i].deadline);
+    }
+    s.start.assign(n, 0);
+    s.completion.assign(n, 0);
+    s.dispatchOrder.assign(n, n);
+    s.busyStart.assign(n, 0);
+    s.checkpoints.clear();
+    s.totalTurnAround = s.totalWaiting = s.totalResponse = 0;
+
+    vector<pair<int, int>> ready;
+    int currentTime = 0, idx = 0, oldestWaiting = 0;
+    auto admitArrivals = [&]() {
+        while (idx < n && s.arrival[idx] <= currentTime) {
+            ready.push_back(make_pair(s.key[idx], idx));
+            push_heap(ready.begin(), ready.end(), greater<pair<int, int>>());
+            idx++;
+        }
+    };
+    for (int dispatched = 0; dispatched < n; ++dispatched) {
+        if (dispatched % s.interval == 0) {
+            while (oldestWaiting < idx && s.dispatchOrder[oldestWaiting] < dispatched) oldestWaiting++;
+            s.checkpoints.push_back({currentTime, idx, dispatched, oldestWaiting});
+        }
+        admitArrivals();
+        if (ready.empty()) {
+            s.busyStart[idx] = 1; // CPU idle: what follows depends only on jobs idx..n-1
+            currentTime = s.arrival[idx];
+            admitArrivals();
+        }
+        pop_heap(ready.begin(), ready.end(), greater<pair<int, int>>());
+        int i = ready.back().second;
+        ready.pop_back();
+        s.dispatchOrder[i] = dispatched;
+        s.start[i] = currentTime;
+        currentTime += s.burst[i];
+        s.completion[i] = currentTime;
+        s.totalTurnAround += currentTime - s.arrival[i];
+        s.totalWaiting += currentTime - s.arrival[i] - s.burst[i];
+        s.totalResponse += s.start[i] - s.arrival[i];
+    }
+    s.makespan = currentTime;
+}
+
+/*
+Function to describe an edit of the base trace: kind 1 adds a job, 2 removes job `index`,
+3 changes job `index`. The edited job is placed where a stable sort by arrival of the
+edited trace would put it.
+*/
+JobEdit makeJobEdit(const IncrementalSchedule& s, int kind, int index, int arrival, int burst, int priority, int deadline) {
+    JobEdit edit;
+    edit.base = &s;
+    int n = s.arrival.size();
+    edit.size = n + (kind == 1) - (kind == 2);
+    if (kind == 2 || kind == 3) {
+        edit.removed = index;
+    }
+    if (kind == 1 || kind == 3) {
+        int lo = lower_bound(s.arrival.begin(), s.arrival.end(), arrival) - s.arrival.begin();
+        int hi = upper_bound(s.arrival.begin(), s.arrival.end(), arrival) - s.arrival.begin();
+        int position = kind == 1 ? hi : min(max(index, lo), hi); // base position, before the removal
+        edit.inserted = kind == 3 && position > index ? position - 1 : position;
+        edit.insertedArrival = arrival;
+        edit.insertedBurst = burst;
+        edit.insertedKey = policyKey(s.policy, burst, priority, deadline);
+    }
+    return edit;
+}
+
+// Function to re-schedule an edited trace from the last usable checkpoint (or from scratch) until it reconverges
+IncrementalResult rescheduleIncremental(const IncrementalSchedule& s, const JobEdit& edit, bool fromScratch = false) {
+    IncrementalResult result;
+    int n = edit.size;
+    int firstAffected = edit.removed == -1 ? edit.inserted : edit.inserted == -1 ? edit.removed : min(edit.removed, edit.inserted);
+
+    /*
+    Last checkpoint that has admitted nothing at or after the edit (jobs before it keep the
+    same index) and whose earlier decisions were all taken before the edited job arrives
+    */
+    NonPreemptiveCheckpoint initial = {0, 0, 0, 0};
+    const NonPreemptiveCheckpoint* from = &initial;
+    if (!fromScratch) {
+        auto it = upper_bound(s.checkpoints.begin(), s.checkpoints.end(), firstAffected,
+                              [](int cursor, const NonPreemptiveCheckpoint& c) { return cursor < c.nextArrival; });
+        if (edit.inserted != -1) {
+            it = min(it, upper_bound(s.checkpoints.begin(), s.checkpoints.end(), edit.insertedArrival,
+                                     [](int time, const NonPreemptiveCheckpoint& c) { return time < c.currentTime; }));
+        }
+        if (it != s.checkpoints.begin()) from = &*(it - 1);
+    }
+    result.resumedAt = from->currentTime;
+
+    // Rebuild the ready heap: admitted jobs the base run had not dispatched by the checkpoint
+    long long oldTurnAround = 0, oldWaiting = 0, oldResponse = 0;
+    auto subtract = [&](int i) {
+        oldTurnAround += s.completion[i] - s.arrival[i];
+        oldWaiting += s.completion[i] - s.arrival[i] - s.burst[i];
+        oldResponse += s.start[i] - s.arrival[i];
+    };
+    vector<pair<int, int>> ready;
+    for (int i = from->oldestWaiting; i < from->nextArrival; ++i) {
+        if (s.dispatchOrder[i] >= from->dispatched) {
+            ready.push_back(make_pair(s.key[i], i));
+            subtract(i);
+        }
+    }
+    make_heap(ready.begin(), ready.end(), greater<pair<int, int>>());
+
+    int currentTime = from->currentTime, idx = from->nextArrival;
+    long long newTurnAround = 0, newWaiting = 0, newResponse = 0;
+    auto admitArrivals = [&]() {
+        while (idx < n && edit.arrival(idx) <= currentTime) {
+            ready.push_back(make_pair(edit.key(idx), idx));
+            push_heap(ready.begin(), ready.end(), greater<pair<int, int>>());
+            idx++;
+        }
+    };
+    while (idx < n || !ready.empty()) {
+        admitArrivals();
+        if (ready.empty()) {
+            int baseIdx = edit.baseIndex(idx);
+            if (!fromScratch && idx > edit.inserted && baseIdx > edit.removed && s.busyStart[baseIdx]) {
+                result.convergedAt = idx;
+                break;
+            }
+            currentTime = edit.arrival(idx);
+            admitArrivals();
+        }
+        pop_heap(ready.begin(), ready.end(), greater<pair<int, int>>());
+        int i = ready.back().second;
+        ready.pop_back();
+        int start = currentTime;
+        currentTime += edit.burst(i);
+        newTurnAround += currentTime - edit.arrival(i);
+        newWaiting += currentTime - edit.arrival(i) - edit.burst(i);
+        newResponse += start - edit.arrival(i);
+        result.changed.push_back(make_tuple(i, start, currentTime));
+    }
+    result.resimulated = result.changed.size();
+    result.count = n;
+
+    if (fromScratch) {
+        result.totalTurnAround = newTurnAround;
+        result.totalWaiting = newWaiting;
+        result.totalResponse = newResponse;
+        result.makespan = currentTime;
+        return result;
+    }
+
+    // The base run dispatched the checkpoint's ready jobs and the arrivals up to the convergence point in the same window
+    int windowEnd = result.convergedAt == -1 ? (int)s.arrival.size() : edit.baseIndex(result.convergedAt);
+    for (int i = from->nextArrival; i < windowEnd; ++i) subtract(i);
+
+    result.totalTurnAround = s.totalTurnAround - oldTurnAround + newTurnAround;
+    result.totalWaiting = s.totalWaiting - oldWaiting + newWaiting;
+    result.totalResponse = s.totalResponse - oldResponse + newResponse;
+    result.makespan = result.convergedAt == -1 ? currentTime : s.makespan;
+    return result;
 }
 
 int main() {
@@ -453,35 +3107,369 @@ int main() {
     cout << "6. Highest Priority[p]\n";
     cout << "7. Highest Response Ratio Next (HRRN)\n";
     cout << "8. Longest Remaining Time First(LRTF) [p]\n";
+    cout << "9. Benchmark selection kernels\n";
+    cout << "10. SRTF with periodic checkpoints\n";
+    cout << "11. Resume SRTF from checkpoint\n";
+    cout << "12. Monte Carlo what-if (perturbed replays)\n";
+    cout << "13. Shortest Jump First[non-p] on predicted bursts\n";
+    cout << "14. Shortest Remaining Time First[p] on predicted bursts\n";
+    cout << "15. Earliest Deadline First[non-p] (EDF)\n";
+    cout << "16. Earliest Deadline First[p] (EDF)\n";
+    cout << "17. Compare deadline misses: EDF vs HP vs SRTF\n";
+    cout << "18. Completely Fair Scheduler (CFS) [p]\n";
+    cout << "19. CPU / I/O burst simulation\n";
+    cout << "20. Benchmark timing wheel vs binary heap\n";
+    cout << "21. Convert a text workload to a binary trace\n";
+    cout << "22. Run a binary trace (memory-mapped)\n";
+    cout << "23. Batch mode: schedule every workload in a file\n";
+    cout << "24. Export execution trace (Chrome / Perfetto JSON)\n";
+    cout << "25. Incremental what-if: edit one job and re-schedule\n";
     cout << "Enter your choice: ";
     cin >> choice;
+    // Only the I/O simulation (option 19) models I/O phases; every other run schedules
+    // each process's total CPU time
+    if (choice != 19) {
+        foldPhases(processes);
+    }
+
+    if (choice == 9) {
+        benchmarkSelectionKernels();
+        return 0;
+    }
+
+    if (choice == 21) {
+        string textPath, tracePath;
+        int section;
+        cout << "Text workload file (format of input.txt): ";
+        cin >> textPath;
+        cout << "Workload number (0 = all processes in the file): ";
+        cin >> section;
+        cout << "Binary trace file: ";
+        cin >> tracePath;
+        ifstream in(textPath);
+        vector<Workload> workloads = readWorkloads(in);
+        vector<Process> trace;
+        for (int w = 0; w < (int)workloads.size(); ++w) {
+            if (section == 0 || section == w + 1) {
+                trace.insert(trace.end(), workloads[w].processes.begin(), workloads[w].processes.end());
+            }
+        }
+        // Traces have no I/O columns: a process with CPU / I-O phases keeps only its total CPU time
+        int folded = foldPhases(trace);
+        if (!in.eof() || trace.empty() || !writeTrace(trace, tracePath)) {
+            cout << "Could not convert " << textPath << ".\n";
+            return 1;
+        }
+        cout << "Wrote " << trace.size() << " processes to " << tracePath << "\n";
+        if (folded > 0) {
+            cout << "Warning: " << folded << " processes had I/O phases; only their CPU time was kept.\n";
+        }
+        return 0;
+    }
+
+    if (choice == 22) {
+        string tracePath;
+        int algorithm, fromTime, toTime;
+        cout << "Binary trace file: ";
+        cin >> tracePath;
+        cout << "Algorithm (1 = FCFS, 3 = SPN, 5 = Highest Priority, 7 = HRRN): ";
+        cin >> algorithm;
+        cout << "Arrival window start and end (e.g. 0 2147483647): ";
+        cin >> fromTime >> toTime;
+        MappedTrace trace;
+        if (!trace.open(tracePath)) {
+            cout << "Could not map " << tracePath << ".\n";
+            return 1;
+        }
+        if (!runMappedTrace(trace, algorithm, fromTime, toTime)) {
+            cout << "Invalid choice.\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    if (choice == 20) {
+        int events, pending;
+        cout << "Number of events (e.g. 10000000): ";
+        cin >> events;
+        cout << "Pending timers (e.g. 100000): ";
+        cin >> pending;
+        benchmarkTimerWheel(events, max(1, pending));
+        return 0;
+    }
+
+    if (choice == 12) {
+        int algorithm, slice = 0, variants, threads;
+        unsigned seed;
+        WhatIf whatIf;
+        cout << "Algorithm to replay (1-8): ";
+        cin >> algorithm;
+        if (algorithm == 2) {
+            cout << "Enter time slice for Round Robin: ";
+            cin >> slice;
+        }
+        cout << "Number of variants: ";
+        cin >> variants;
+        cout << "Load change (%): ";
+        cin >> whatIf.loadPercent;
+        cout << "Burst estimation error (+-%): ";
+        cin >> whatIf.burstErrorPercent;
+        cout << "Arrival jitter (+- time units): ";
+        cin >> whatIf.arrivalJitter;
+        cout << "Seed: ";
+        cin >> seed;
+        cout << "Threads (0 = all cores): ";
+        cin >> threads;
+        if (algorithm < 1 || algorithm > 8 || variants < 1) {
+            cout << "Invalid choice.\n";
+            return 1;
+        }
+        if (threads <= 0) {
+            threads = max(1u, thread::hardware_concurrency());
+        }
+        monteCarloWhatIf(processes, algorithm, slice, variants, whatIf, seed, threads);
+        return 0;
+    }
+
+    if (choice == 23) {
+        string inputPath, outputPath;
+        int algorithm, slice = 0, threads;
+        cout << "Workload file (format of input.txt, one numbered section per workload): ";
+        cin >> inputPath;
+        cout << "Algorithm (1-8): ";
+        cin >> algorithm;
+        if (algorithm == 2) {
+            cout << "Enter time slice for Round Robin: ";
+            cin >> slice;
+        }
+        cout << "Threads (0 = all cores): ";
+        cin >> threads;
+        cout << "Result file (CSV): ";
+        cin >> outputPath;
+        if (algorithm < 1 || algorithm > 8) {
+            cout << "Invalid choice.\n";
+            return 1;
+        }
+        if (threads <= 0) {
+            threads = max(1u, thread::hardware_concurrency());
+        }
+        if (!runBatch(inputPath, outputPath, algorithm, slice, threads)) {
+            cout << "Could not run batch " << inputPath << ".\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    if (choice == 24) {
+        string path;
+        int algorithm, slice = 0, n;
+        cout << "Algorithm (1-8): ";
+        cin >> algorithm;
+        if (algorithm == 2) {
+            cout << "Enter time slice for Round Robin: ";
+            cin >> slice;
+        }
+        cout << "Number of random processes (0 = built-in sample): ";
+        cin >> n;
+        cout << "Trace file (JSON): ";
+        cin >> path;
+        if (algorithm < 1 || algorithm > 8) {
+            cout << "Invalid choice.\n";
+            return 1;
+        }
+        if (n > 0) {
+            processes = generateWorkload(n, 42 + n);
+        }
+        sortByArrival(processes);
+        ChromeTraceWriter writer;
+        if (!writer.open(path)) {
+            cout << "Could not write " << path << ".\n";
+            return 1;
+        }
+        sliceSink = &writer;
+        runScheduler(algorithm, processes, slice);
+        sliceSink = nullptr;
+        if (!writer.close()) {
+            cout << "Could not write " << path << ".\n";
+            return 1;
+        }
+        cout << "Wrote " << writer.events << " events (" << writer.slices << " slices) to " << path << "\n";
+        return 0;
+    }
+
+    if (choice == 25) {
+        int algorithm, n, utilization = 100, interval, kind, index = 0, arrival = 0, burst = 0, priority = 0, deadline = 0;
+        cout << "Algorithm (1 = FCFS, 3 = SPN, 5 = Highest Priority, 15 = EDF): ";
+        cin >> algorithm;
+        cout << "Number of random processes (0 = built-in sample): ";
+        cin >> n;
+        if (n > 0) {
+            cout << "CPU utilization of the random workload (%, e.g. 80): ";
+            cin >> utilization;
+        }
+        cout << "Checkpoint interval (dispatches, e.g. 4096): ";
+        cin >> interval;
+        cout << "Edit (1 = add a job, 2 = remove a job, 3 = change a job): ";
+        cin >> kind;
+        if (kind == 2 || kind == 3) {
+            cout << "Job number in arrival order (1-based): ";
+            cin >> index;
+        }
+        if (kind == 1 || kind == 3) {
+            cout << "Arrival, burst, priority and deadline (0 = none) of the job: ";
+            cin >> arrival >> burst >> priority >> deadline;
+        }
+        if (n > 0) {
+            processes = generateWorkload(n, 42 + n);
+            // generateWorkload offers ~210% load; stretch arrivals to the requested utilization
+            for (auto& process : processes) {
+                process.arrivalTime = (long long)process.arrivalTime * 210 / max(1, utilization);
+            }
+        }
+        sortByArrival(processes);
+        bool validIndex = kind == 1 || (index >= 1 && index <= (int)processes.size());
+        if ((algorithm != 1 && algorithm != 3 && algorithm != 5 && algorithm != 15) || kind < 1 || kind > 3
+            || !validIndex || (kind != 2 && burst < 1)) {
+            cout << "Invalid choice.\n";
+            return 1;
+        }
+
+        IncrementalSchedule schedule;
+        auto start = chrono::steady_clock::now();
+        buildIncrementalSchedule(schedule, processes, algorithm, interval);
+        double buildSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        JobEdit edit = makeJobEdit(schedule, kind, index - 1, arrival, burst, priority, deadline);
+
+        start = chrono::steady_clock::now();
+        IncrementalResult result = rescheduleIncremental(schedule, edit);
+        double incrementalSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        start = chrono::steady_clock::now();
+        IncrementalResult full = rescheduleIncremental(schedule, edit, true);
+        double fullSeconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+        auto name = [&](int k) { return k == edit.inserted ? string("new job") : processes[edit.baseIndex(k)].name; };
+        cout << fixed << setprecision(3);
+        cout << "Base schedule: " << processes.size() << " jobs, " << schedule.checkpoints.size() << " checkpoints, "
+             << buildSeconds * 1e3 << " ms\n";
+        cout << "Incremental: resumed at t=" << result.resumedAt << ", re-simulated " << result.resimulated << " jobs, ";
+        if (result.convergedAt != -1) {
+            cout << "reconverged at " << name(result.convergedAt) << " (t=" << edit.arrival(result.convergedAt) << ")";
+        } else {
+            cout << "ran to the end";
+        }
+        cout << ", " << incrementalSeconds * 1e3 << " ms\n";
+        cout << "Full re-run: " << fullSeconds * 1e3 << " ms\n";
+        bool same = result.totalTurnAround == full.totalTurnAround && result.totalWaiting == full.totalWaiting
+                    && result.totalResponse == full.totalResponse && result.makespan == full.makespan;
+        cout << setprecision(2);
+        cout << "Avg TAT: " << (double)result.totalTurnAround / max(1, result.count) << "\n";
+        cout << "Avg WT : " << (double)result.totalWaiting / max(1, result.count) << "\n";
+        cout << "Avg RT : " << (double)result.totalResponse / max(1, result.count) << "\n";
+        cout << "Makespan: " << result.makespan << (same ? " (matches the full re-run)" : " (DIFFERS from the full re-run)") << "\n";
+        cout << "Re-simulated jobs (first 10): ";
+        for (int i = 0; i < (int)result.changed.size() && i < 10; ++i) {
+            cout << name(get<0>(result.changed[i])) << " [" << get<1>(result.changed[i]) << ", "
+                 << get<2>(result.changed[i]) << ") ";
+        }
+        cout << "\n";
+        return same ? 0 : 1;
+    }
+
+    int ioPolicy = 0;
+    if (choice == 19) {
+        cout << "Ready queue policy (1 = FCFS, 2 = RR, 3 = SPN, 4 = SRTF, 5 = Highest Priority, 16 = EDF[p], 18 = CFS): ";
+        cin >> ioPolicy;
+        if (ioPolicy != 1 && ioPolicy != 2 && ioPolicy != 3 && ioPolicy != 4 && ioPolicy != 5 && ioPolicy != 16
+            && ioPolicy != 18) {
+            cout << "Invalid choice.\n";
+            return 1;
+        }
+    }
 
     int slice = 0;
-    if (choice == 2) {
+    if (choice == 2 || ioPolicy == 2) {
         cout << "Enter time slice for Round Robin: ";
         cin >> slice;
     }
 
+    int schedLatency = 0, minGranularity = 1;
+    if (choice == 18 || ioPolicy == 18) {
+        cout << "Enter scheduling latency (target period): ";
+        cin >> schedLatency;
+        cout << "Enter minimum granularity: ";
+        cin >> minGranularity;
+    }
+
+    double alpha = 0.5, initialEstimate = 0;
+    if (choice == 13 || choice == 14) {
+        cout << "Enter smoothing factor alpha (0-1): ";
+        cin >> alpha;
+        cout << "Enter initial burst estimate: ";
+        cin >> initialEstimate;
+    }
+
     // Sort processes by arrival time
-    sort(processes.begin(), processes.end(), compareArrival);
+    sortByArrival(processes);
+
+    if (choice == 17) {
+        compareDeadlineSchedulers(processes);
+        return 0;
+    }
+
+    resetProfile();
 
     // Perform scheduling based on user choice
-    if (choice == 1) {
-        firstComeFirstServe(processes);
-    } else if (choice == 2) {
-        roundRobin(processes, slice);
-    } else if (choice == 3) {
-        shortestProcessNext(processes);
-    } else if (choice == 4) {
-        shortestRemainingTimeFirst(processes);
-    } else if (choice == 5) {
-        highestPriority(processes);
-    } else if (choice == 6) {
-        preemptiveHighestPriority(processes);
-    } else if (choice == 7) {
-        highestResponseRatioNext(processes);
-    } else if (choice == 8) {
-        longestRemainingTimeFirst(processes);
+    if (choice >= 1 && choice <= 8) {
+        runScheduler(choice, processes, slice);
+    } else if (choice == 15) {
+        earliestDeadlineFirst(processes);
+    } else if (choice == 16) {
+        preemptiveEarliestDeadlineFirst(processes);
+    } else if (choice == 18) {
+        completelyFairScheduler(processes, schedLatency, minGranularity);
+    } else if (choice == 19) {
+        if (ioPolicy == 4) {
+            shortestRemainingTimeFirst(processes, true);
+        } else if (ioPolicy == 16) {
+            preemptiveEarliestDeadlineFirst(processes, true);
+        } else if (ioPolicy == 18) {
+            completelyFairScheduler(processes, schedLatency, minGranularity, true);
+        } else {
+            ioBurstScheduler(processes, ioPolicy, slice);
+        }
+        printIoStats(processes, cpuUtilization(processes));
+    } else if (choice == 13) {
+        predictedShortestProcessNext(processes, alpha, initialEstimate);
+        printPredictionError(processes);
+    } else if (choice == 14) {
+        predictedShortestRemainingTimeFirst(processes, alpha, initialEstimate);
+        printPredictionError(processes);
+    } else if (choice == 10) {
+        int interval;
+        string path;
+        cout << "Enter checkpoint interval (time units): ";
+        cin >> interval;
+        cout << "Enter checkpoint file: ";
+        cin >> path;
+        runShortestRemainingTimeFirst(processes, SimCheckpoint(), interval, path);
+    } else if (choice == 11) {
+        string path;
+        SimCheckpoint state;
+        cout << "Enter checkpoint file: ";
+        cin >> path;
+        if (!loadCheckpoint(state, path) || !checkpointFitsTrace(state, processes)) {
+            cout << "Checkpoint " << path << " is unreadable or belongs to a different workload.\n";
+            return 1;
+        }
+        int resumedAt = state.currentTime;
+        state = runShortestRemainingTimeFirst(processes, state);
+        // Processes completed before the checkpoint only survive as totals
+        cout << "Resumed at t=" << resumedAt << ", finished at t=" << state.currentTime << "\n";
+        cout << "Completed: " << state.completedProcesses << "\n";
+        cout << "Avg TAT: " << fixed << setprecision(2) << (double)state.totalTurnAround / state.completedProcesses << "\n";
+        cout << "Avg WT : " << (double)state.totalWaiting / state.completedProcesses << "\n";
+        cout << "Avg RT : " << (double)state.totalResponse / state.completedProcesses << "\n";
+        return 0;
     }
 
     else {
@@ -491,6 +3479,13 @@ int main() {
 
     // Print statistics
     printStats(processes);
+    if (choice == 15 || choice == 16) {
+        DeadlineStats stats = deadlineStats(processes);
+        cout << "Deadline misses: " << stats.misses << " of " << stats.withDeadline
+             << ", mean lateness " << fixed << setprecision(2) << stats.meanLateness
+             << ", max lateness " << stats.maxLateness << ", mean tardiness " << stats.meanTardiness << "\n";
+    }
+    printProfileReport(processes.size());
 
     // Print timeline
     